@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "dataset-delta.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/encoding/tlv-nfd.hpp>
+
+namespace nfd {
+
+size_t
+DatasetDeltaHeader::wireEncode(ndn::encoding::EncodingBuffer& encoder) const
+{
+  size_t totalLength = 0;
+  if (isFullSnapshot) {
+    totalLength += ndn::encoding::prependEmptyBlock(encoder, tlv::FullSnapshot);
+  }
+  totalLength += ndn::encoding::prependNonNegativeIntegerBlock(encoder, tlv::DatasetVersion, version);
+  totalLength += ndn::encoding::prependNonNegativeIntegerBlock(encoder, tlv::DatasetEpoch, epoch);
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::DatasetDeltaHeader);
+  return totalLength;
+}
+
+Block
+DatasetDeltaHeader::wireEncode() const
+{
+  ndn::encoding::EncodingBuffer encoder;
+  wireEncode(encoder);
+  return encoder.block();
+}
+
+void
+DatasetDeltaHeader::wireDecode(const Block& block)
+{
+  if (block.type() != tlv::DatasetDeltaHeader) {
+    NDN_THROW(tlv::Error("DatasetDeltaHeader", block.type()));
+  }
+  block.parse();
+
+  auto val = block.elements_begin();
+  auto end = block.elements_end();
+  if (val == end || val->type() != tlv::DatasetEpoch) {
+    NDN_THROW(tlv::Error("Missing required DatasetEpoch element"));
+  }
+  epoch = ndn::encoding::readNonNegativeInteger(*val);
+  ++val;
+
+  if (val == end || val->type() != tlv::DatasetVersion) {
+    NDN_THROW(tlv::Error("Missing required DatasetVersion element"));
+  }
+  version = ndn::encoding::readNonNegativeInteger(*val);
+  ++val;
+
+  isFullSnapshot = val != end && val->type() == tlv::FullSnapshot;
+}
+
+size_t
+DatasetRemoval::wireEncode(ndn::encoding::EncodingBuffer& encoder) const
+{
+  size_t totalLength = 0;
+  if (const auto* name = std::get_if<Name>(&key)) {
+    totalLength += name->wireEncode(encoder);
+  }
+  else {
+    totalLength += ndn::encoding::prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceId,
+                                                                 std::get<uint64_t>(key));
+  }
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::DatasetRemoval);
+  return totalLength;
+}
+
+Block
+DatasetRemoval::wireEncode() const
+{
+  ndn::encoding::EncodingBuffer encoder;
+  wireEncode(encoder);
+  return encoder.block();
+}
+
+void
+DatasetRemoval::wireDecode(const Block& block)
+{
+  if (block.type() != tlv::DatasetRemoval) {
+    NDN_THROW(tlv::Error("DatasetRemoval", block.type()));
+  }
+  block.parse();
+
+  auto val = block.elements_begin();
+  if (val == block.elements_end()) {
+    NDN_THROW(tlv::Error("Missing required Name or FaceId element"));
+  }
+  switch (val->type()) {
+    case tlv::Name:
+      key = Name(*val);
+      break;
+    case tlv::nfd::FaceId:
+      key = ndn::encoding::readNonNegativeInteger(*val);
+      break;
+    default:
+      NDN_THROW(tlv::Error("Unexpected element of type " + std::to_string(val->type())));
+  }
+}
+
+} // namespace nfd
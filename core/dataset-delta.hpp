@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NFD_CORE_DATASET_DELTA_HPP
+#define NFD_CORE_DATASET_DELTA_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer-fwd.hpp>
+
+#include <variant>
+
+namespace nfd {
+
+namespace tlv {
+
+/**
+ * \brief TLV-TYPE numbers of the delta datasets.
+ * \sa DatasetDeltaHeader, DatasetRemoval
+ */
+enum : uint32_t {
+  DatasetDeltaHeader = 1010,
+  DatasetVersion     = 1011,
+  FullSnapshot       = 1012,
+  DatasetRemoval     = 1013,
+  DatasetEpoch       = 1014,
+};
+
+} // namespace tlv
+
+/**
+ * \brief The first item of a delta dataset.
+ *
+ *     DatasetDeltaHeader = DATASET-DELTA-HEADER-TYPE TLV-LENGTH
+ *                            DatasetEpoch
+ *                            DatasetVersion
+ *                            [FullSnapshot]
+ *
+ *     FullSnapshot = FULL-SNAPSHOT-TYPE TLV-LENGTH(=0)
+ *
+ * A delta dataset is requested as `<module>/changes/<E>/<N>`, where E and N are
+ * NonNegativeInteger name components carrying the DatasetEpoch and the DatasetVersion of the
+ * last response the client has seen; a request without them asks for a full snapshot.
+ * The epoch is chosen at random whenever NFD starts, so that versions counted by a previous
+ * instance are never mistaken for current ones.
+ *
+ * If FullSnapshot is present, the header is followed by every item of the regular `list`
+ * dataset and the client should discard its previous state. This happens when E does not
+ * match the current epoch, or when the changes after version N are no longer known.
+ * Otherwise, the header is followed by the items that were added or changed after version N,
+ * and by a DatasetRemoval for each item that was removed after version N. In either case, the
+ * client should request `<module>/changes/<DatasetEpoch>/<DatasetVersion>` next time.
+ */
+struct DatasetDeltaHeader
+{
+  uint64_t epoch = 0;
+  uint64_t version = 0;
+  bool isFullSnapshot = false;
+
+  /**
+   * \brief Prepends the wire encoding to \p encoder.
+   * \return number of bytes prepended
+   */
+  size_t
+  wireEncode(ndn::encoding::EncodingBuffer& encoder) const;
+
+  Block
+  wireEncode() const;
+
+  /**
+   * \throw tlv::Error the encoding is invalid
+   */
+  void
+  wireDecode(const Block& block);
+};
+
+/**
+ * \brief The point in the history of a dataset up to which a client has seen its changes.
+ * \sa DatasetDeltaHeader
+ */
+struct DatasetPosition
+{
+  uint64_t epoch = 0;
+  uint64_t version = 0;
+};
+
+/**
+ * \brief An item of a delta dataset that indicates the removal of a FIB entry, a RIB entry,
+ *        or a face.
+ *
+ *     DatasetRemoval = DATASET-REMOVAL-TYPE TLV-LENGTH
+ *                        (Name / FaceId)
+ */
+struct DatasetRemoval
+{
+  using Key = std::variant<Name, uint64_t>;
+
+  Key key;
+
+  /**
+   * \brief Prepends the wire encoding to \p encoder.
+   * \return number of bytes prepended
+   */
+  size_t
+  wireEncode(ndn::encoding::EncodingBuffer& encoder) const;
+
+  Block
+  wireEncode() const;
+
+  /**
+   * \throw tlv::Error the encoding is invalid
+   */
+  void
+  wireDecode(const Block& block);
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_DATASET_DELTA_HPP
@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "latency-histogram.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/encoding/tlv-nfd.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace nfd {
+
+static size_t
+computeBucketIndex(uint64_t ns) noexcept
+{
+  if (ns == 0) {
+    return 0;
+  }
+#if defined(__GNUC__)
+  size_t i = 63 - __builtin_clzll(ns);
+#else
+  size_t i = 0;
+  while (ns >>= 1) {
+    ++i;
+  }
+#endif
+  return std::min(i, LatencyHistogram::N_BUCKETS - 1);
+}
+
+void
+LatencyHistogram::record(time::nanoseconds latency) noexcept
+{
+  latency = std::max(latency, 0_ns);
+  ++m_count;
+  m_sum += latency;
+  m_max = std::max(m_max, latency);
+  ++m_buckets[computeBucketIndex(static_cast<uint64_t>(latency.count()))];
+}
+
+time::nanoseconds
+LatencyHistogram::getQuantile(double q) const
+{
+  if (m_count == 0) {
+    return 0_ns;
+  }
+
+  auto rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * m_count));
+  rank = std::max<uint64_t>(rank, 1);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < N_BUCKETS; ++i) {
+    seen += m_buckets[i];
+    if (seen >= rank) {
+      auto upper = time::nanoseconds((uint64_t{1} << (i + 1)) - 1);
+      return std::min(upper, m_max);
+    }
+  }
+  return m_max;
+}
+
+size_t
+LatencyStatus::wireEncode(ndn::encoding::EncodingBuffer& encoder) const
+{
+  const auto& buckets = histogram.m_buckets;
+  size_t nBuckets = buckets.size();
+  while (nBuckets > 0 && buckets[nBuckets - 1] == 0) {
+    --nBuckets;
+  }
+
+  size_t totalLength = 0;
+  for (size_t i = nBuckets; i > 0; --i) {
+    totalLength += ndn::encoding::prependNonNegativeIntegerBlock(encoder, tlv::LatencyBucket,
+                                                                 buckets[i - 1]);
+  }
+  totalLength += ndn::encoding::prependNonNegativeIntegerBlock(encoder, tlv::LatencyMax,
+                                                               histogram.m_max.count());
+  totalLength += ndn::encoding::prependNonNegativeIntegerBlock(encoder, tlv::LatencySum,
+                                                               histogram.m_sum.count());
+  totalLength += ndn::encoding::prependNonNegativeIntegerBlock(encoder, tlv::LatencyCount,
+                                                               histogram.m_count);
+  if (faceId) {
+    totalLength += ndn::encoding::prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceId, *faceId);
+  }
+  totalLength += ndn::encoding::prependStringBlock(encoder, tlv::LatencyLabel, label);
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(tlv::LatencyStatus);
+  return totalLength;
+}
+
+Block
+LatencyStatus::wireEncode() const
+{
+  ndn::encoding::EncodingBuffer encoder;
+  wireEncode(encoder);
+  return encoder.block();
+}
+
+void
+LatencyStatus::wireDecode(const Block& block)
+{
+  if (block.type() != tlv::LatencyStatus) {
+    NDN_THROW(tlv::Error("LatencyStatus", block.type()));
+  }
+  block.parse();
+
+  auto val = block.elements_begin();
+  auto end = block.elements_end();
+  auto expect = [&] (uint32_t type) {
+    if (val == end || val->type() != type) {
+      NDN_THROW(tlv::Error("Missing required element of type " + std::to_string(type)));
+    }
+  };
+
+  expect(tlv::LatencyLabel);
+  label = ndn::encoding::readString(*val);
+  ++val;
+
+  faceId.reset();
+  if (val != end && val->type() == tlv::nfd::FaceId) {
+    faceId = ndn::encoding::readNonNegativeInteger(*val);
+    ++val;
+  }
+
+  histogram = {};
+  expect(tlv::LatencyCount);
+  histogram.m_count = ndn::encoding::readNonNegativeInteger(*val);
+  ++val;
+  expect(tlv::LatencySum);
+  histogram.m_sum = time::nanoseconds(ndn::encoding::readNonNegativeInteger(*val));
+  ++val;
+  expect(tlv::LatencyMax);
+  histogram.m_max = time::nanoseconds(ndn::encoding::readNonNegativeInteger(*val));
+  ++val;
+
+  for (size_t i = 0; val != end && val->type() == tlv::LatencyBucket; ++i, ++val) {
+    if (i >= LatencyHistogram::N_BUCKETS) {
+      NDN_THROW(tlv::Error("Too many LatencyBucket elements"));
+    }
+    histogram.m_buckets[i] = ndn::encoding::readNonNegativeInteger(*val);
+  }
+}
+
+} // namespace nfd
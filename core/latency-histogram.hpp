@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NFD_CORE_LATENCY_HISTOGRAM_HPP
+#define NFD_CORE_LATENCY_HISTOGRAM_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer-fwd.hpp>
+
+#include <array>
+
+namespace nfd {
+
+namespace tlv {
+
+/**
+ * \brief TLV-TYPE numbers of the latency dataset.
+ * \sa LatencyStatus
+ */
+enum : uint32_t {
+  LatencyStatus  = 1000,
+  LatencyLabel   = 1001,
+  LatencyCount   = 1002,
+  LatencySum     = 1003,
+  LatencyMax     = 1004,
+  LatencyBucket  = 1005,
+};
+
+} // namespace tlv
+
+/**
+ * \brief A histogram of latencies with logarithmic buckets.
+ *
+ * Bucket `i` counts latencies of at least 2^i and less than 2^(i+1) nanoseconds.
+ * Bucket 0 also counts latencies shorter than 1 nanosecond, and the last bucket
+ * also counts latencies that are too long for it.
+ */
+class LatencyHistogram
+{
+public:
+  static constexpr size_t N_BUCKETS = 40;
+
+  void
+  record(time::nanoseconds latency) noexcept;
+
+  uint64_t
+  getCount() const noexcept
+  {
+    return m_count;
+  }
+
+  time::nanoseconds
+  getSum() const noexcept
+  {
+    return m_sum;
+  }
+
+  time::nanoseconds
+  getMax() const noexcept
+  {
+    return m_max;
+  }
+
+  uint64_t
+  getBucket(size_t i) const
+  {
+    return m_buckets.at(i);
+  }
+
+  /**
+   * \brief Returns an upper bound of the \p q quantile.
+   * \param q quantile between 0 and 1, e.g., 0.99 for the 99th percentile
+   * \return the upper limit of the bucket containing the quantile, capped at getMax(),
+   *         or zero if the histogram is empty
+   */
+  time::nanoseconds
+  getQuantile(double q) const;
+
+private:
+  friend bool
+  operator==(const LatencyHistogram& lhs, const LatencyHistogram& rhs) noexcept
+  {
+    return lhs.m_count == rhs.m_count && lhs.m_sum == rhs.m_sum && lhs.m_max == rhs.m_max &&
+           lhs.m_buckets == rhs.m_buckets;
+  }
+
+private:
+  uint64_t m_count = 0;
+  time::nanoseconds m_sum = 0_ns;
+  time::nanoseconds m_max = 0_ns;
+  std::array<uint64_t, N_BUCKETS> m_buckets{};
+
+  friend struct LatencyStatus;
+};
+
+/**
+ * \brief An item of the latency dataset: the histogram of one forwarding stage or one face.
+ *
+ *     LatencyStatus = LATENCY-STATUS-TYPE TLV-LENGTH
+ *                       LatencyLabel
+ *                       [FaceId]
+ *                       LatencyCount
+ *                       LatencySum
+ *                       LatencyMax
+ *                       *LatencyBucket
+ *
+ * LatencySum and LatencyMax are in nanoseconds. The n-th LatencyBucket holds the count of
+ * bucket n-1 of the histogram; trailing empty buckets are omitted.
+ */
+struct LatencyStatus
+{
+  std::string label;
+  std::optional<uint64_t> faceId;
+  LatencyHistogram histogram;
+
+  /**
+   * \brief Prepends the wire encoding to \p encoder.
+   * \return number of bytes prepended
+   */
+  size_t
+  wireEncode(ndn::encoding::EncodingBuffer& encoder) const;
+
+  Block
+  wireEncode() const;
+
+  /**
+   * \throw tlv::Error the encoding is invalid
+   */
+  void
+  wireDecode(const Block& block);
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_LATENCY_HISTOGRAM_HPP
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cuckoo-filter.hpp"
+
+#include <algorithm>
+
+namespace nfd {
+
+CuckooFilter::CuckooFilter(size_t nBuckets)
+  : m_buckets(nBuckets, Bucket{})
+  , m_mask(nBuckets - 1)
+{
+  BOOST_ASSERT(nBuckets > 0 && (nBuckets & m_mask) == 0);
+}
+
+CuckooFilter::Fingerprint
+CuckooFilter::makeFingerprint(uint64_t item) noexcept
+{
+  // the high bits are independent of the bucket index, which is taken from the low bits
+  auto fp = static_cast<Fingerprint>(item >> 48);
+  return fp == 0 ? 1 : fp;
+}
+
+size_t
+CuckooFilter::getAltIndex(size_t index, Fingerprint fp) const noexcept
+{
+  // partial-key cuckoo hashing: the alternate bucket is computed from the fingerprint alone,
+  // so that a stored fingerprint can be relocated without knowing the original item
+  return (index ^ (static_cast<size_t>(fp) * 0x5bd1e995)) & m_mask;
+}
+
+bool
+CuckooFilter::bucketContains(size_t index, Fingerprint fp) const noexcept
+{
+  const Bucket& bucket = m_buckets[index];
+  return std::find(bucket.begin(), bucket.end(), fp) != bucket.end();
+}
+
+bool
+CuckooFilter::insertIntoBucket(size_t index, Fingerprint fp) noexcept
+{
+  Bucket& bucket = m_buckets[index];
+  auto slot = std::find(bucket.begin(), bucket.end(), 0);
+  if (slot == bucket.end()) {
+    return false;
+  }
+  *slot = fp;
+  return true;
+}
+
+bool
+CuckooFilter::contains(uint64_t item) const noexcept
+{
+  Fingerprint fp = makeFingerprint(item);
+  size_t i1 = item & m_mask;
+  size_t i2 = getAltIndex(i1, fp);
+  if (bucketContains(i1, fp) || bucketContains(i2, fp)) {
+    return true;
+  }
+  return m_victim && m_victim->fp == fp && (m_victim->index == i1 || m_victim->index == i2);
+}
+
+bool
+CuckooFilter::insert(uint64_t item)
+{
+  if (isFull()) {
+    return false;
+  }
+
+  Fingerprint fp = makeFingerprint(item);
+  size_t index = item & m_mask;
+  if (insertIntoBucket(index, fp) || insertIntoBucket(getAltIndex(index, fp), fp)) {
+    ++m_size;
+    return true;
+  }
+
+  // relocate existing fingerprints to their alternate buckets to make room
+  index = getAltIndex(index, fp);
+  for (size_t kick = 0; kick < MAX_KICKS; ++kick) {
+    Fingerprint& slot = m_buckets[index][m_nKicks++ % BUCKET_SIZE];
+    std::swap(fp, slot);
+    index = getAltIndex(index, fp);
+    if (insertIntoBucket(index, fp)) {
+      ++m_size;
+      return true;
+    }
+  }
+
+  // The item is stored, but the last displaced fingerprint cannot be placed. Keeping it as
+  // the victim ensures that no inserted item is lost, and makes the filter full.
+  m_victim = Victim{index, fp};
+  ++m_size;
+  return true;
+}
+
+} // namespace nfd
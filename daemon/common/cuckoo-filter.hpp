@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_CUCKOO_FILTER_HPP
+#define NFD_DAEMON_COMMON_CUCKOO_FILTER_HPP
+
+#include "core/common.hpp"
+
+#include <array>
+
+namespace nfd {
+
+/**
+ * \brief A cuckoo filter over 64-bit hash values.
+ *
+ * The filter stores a 16-bit fingerprint of each item in one of two candidate buckets of
+ * four slots each, so that it uses about 2 bytes per item at high load. A lookup of an item
+ * that has been inserted always succeeds. A lookup of an item that has not been inserted
+ * succeeds with a probability of about 2 * #BUCKET_SIZE / 65536 (0.012%).
+ *
+ * Items cannot be removed. When the filter is nearly full, an insertion may fail; in that
+ * case, the filter is no longer modified, and all previously inserted items remain found.
+ *
+ * The items must be uniformly distributed hash values, such as those from CityHash.
+ */
+class CuckooFilter
+{
+public:
+  /**
+   * \param nBuckets number of buckets, must be a power of 2
+   */
+  explicit
+  CuckooFilter(size_t nBuckets);
+
+  /**
+   * \brief Returns whether \p item may have been inserted.
+   */
+  bool
+  contains(uint64_t item) const noexcept;
+
+  /**
+   * \brief Inserts \p item.
+   * \retval true the item has been inserted
+   * \retval false the filter is full and the item has not been inserted
+   */
+  bool
+  insert(uint64_t item);
+
+  /**
+   * \brief Returns the number of inserted items.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the maximum number of items that the filter can hold.
+   */
+  size_t
+  getCapacity() const noexcept
+  {
+    return m_buckets.size() * BUCKET_SIZE;
+  }
+
+  /**
+   * \brief Returns whether an insertion has failed.
+   */
+  bool
+  isFull() const noexcept
+  {
+    return m_victim.has_value();
+  }
+
+public:
+  static constexpr size_t BUCKET_SIZE = 4;
+
+private:
+  using Fingerprint = uint16_t;
+  using Bucket = std::array<Fingerprint, BUCKET_SIZE>; // 0 means empty slot
+
+  struct Victim
+  {
+    size_t index;
+    Fingerprint fp;
+  };
+
+  static Fingerprint
+  makeFingerprint(uint64_t item) noexcept;
+
+  size_t
+  getAltIndex(size_t index, Fingerprint fp) const noexcept;
+
+  bool
+  bucketContains(size_t index, Fingerprint fp) const noexcept;
+
+  bool
+  insertIntoBucket(size_t index, Fingerprint fp) noexcept;
+
+private:
+  std::vector<Bucket> m_buckets;
+  size_t m_mask;
+  size_t m_size = 0;
+  size_t m_nKicks = 0;
+  /// fingerprint that could not be placed after a failed insertion
+  std::optional<Victim> m_victim;
+
+  /// Maximum number of relocations in one insertion
+  static constexpr size_t MAX_KICKS = 500;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_CUCKOO_FILTER_HPP
@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_LATENCY_SAMPLER_HPP
+#define NFD_DAEMON_COMMON_LATENCY_SAMPLER_HPP
+
+#include "core/latency-histogram.hpp"
+
+namespace nfd {
+
+/**
+ * \brief Measures one in every N occurrences of an operation into a LatencyHistogram.
+ *
+ * The sampling interval N is process-wide. Sampling keeps the cost of the clock reads
+ * off most packets, while still filling the histogram quickly on a busy forwarder.
+ */
+class LatencySampler : noncopyable
+{
+public:
+  /**
+   * \brief Measures the time between its creation and stop().
+   *
+   * A stopwatch created when the sampler decided to skip the occurrence does nothing.
+   */
+  class Stopwatch
+  {
+  public:
+    /**
+     * \brief Records the elapsed time, divided by \p nOccurrences, as one sample.
+     */
+    void
+    stop(size_t nOccurrences = 1) const noexcept
+    {
+      if (m_sampler != nullptr && nOccurrences > 0) {
+        auto elapsed = time::steady_clock::now() - m_start;
+        m_sampler->m_histogram.record(elapsed / static_cast<int64_t>(nOccurrences));
+      }
+    }
+
+  private:
+    Stopwatch() noexcept = default;
+
+    explicit
+    Stopwatch(LatencySampler& sampler) noexcept
+      : m_sampler(&sampler)
+      , m_start(time::steady_clock::now())
+    {
+    }
+
+  private:
+    LatencySampler* m_sampler = nullptr;
+    time::steady_clock::time_point m_start;
+
+    friend LatencySampler;
+  };
+
+  /**
+   * \brief Measures the time until the end of the enclosing scope.
+   */
+  class Scope : noncopyable
+  {
+  public:
+    explicit
+    Scope(LatencySampler& sampler) noexcept
+      : m_stopwatch(sampler.start())
+    {
+    }
+
+    ~Scope()
+    {
+      m_stopwatch.stop();
+    }
+
+  private:
+    Stopwatch m_stopwatch;
+  };
+
+public:
+  static constexpr uint32_t DEFAULT_INTERVAL = 64;
+
+  /**
+   * \brief Returns the sampling interval; zero means sampling is disabled.
+   */
+  static uint32_t
+  getInterval() noexcept
+  {
+    return s_interval;
+  }
+
+  /**
+   * \brief Sets the sampling interval.
+   * \param interval measure one in every \p interval occurrences; must be zero or a power of two
+   * \throw std::invalid_argument \p interval is not zero nor a power of two
+   */
+  static void
+  setInterval(uint32_t interval);
+
+  /**
+   * \brief Starts a stopwatch if this occurrence should be measured.
+   */
+  Stopwatch
+  start() noexcept
+  {
+    if (s_interval == 0 || (m_count++ & (s_interval - 1)) != 0) {
+      return {};
+    }
+    return Stopwatch(*this);
+  }
+
+  const LatencyHistogram&
+  getHistogram() const noexcept
+  {
+    return m_histogram;
+  }
+
+private:
+  LatencyHistogram m_histogram;
+  uint32_t m_count = 0;
+
+  static inline uint32_t s_interval = DEFAULT_INTERVAL;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_LATENCY_SAMPLER_HPP
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "memory-pool.hpp"
+
+namespace nfd {
+
+FixedSizePool::FixedSizePool(size_t blockSize, size_t nBlocksPerSlab)
+  : m_blockSize((std::max(blockSize, sizeof(FreeBlock)) + MemoryPool::GRANULARITY - 1) /
+                MemoryPool::GRANULARITY * MemoryPool::GRANULARITY)
+  , m_nBlocksPerSlab(nBlocksPerSlab)
+{
+  BOOST_ASSERT(m_nBlocksPerSlab > 0);
+}
+
+void*
+FixedSizePool::allocate()
+{
+  if (m_freeList == nullptr) {
+    this->grow();
+  }
+
+  FreeBlock* block = m_freeList;
+  m_freeList = block->next;
+  ++m_nAllocated;
+  return block;
+}
+
+void
+FixedSizePool::deallocate(void* block) noexcept
+{
+  BOOST_ASSERT(block != nullptr);
+  BOOST_ASSERT(m_nAllocated > 0);
+
+  auto freeBlock = static_cast<FreeBlock*>(block);
+  freeBlock->next = m_freeList;
+  m_freeList = freeBlock;
+  --m_nAllocated;
+}
+
+void
+FixedSizePool::grow()
+{
+  // operator new[] returns storage suitably aligned for std::max_align_t
+  auto& slab = m_slabs.emplace_back(new std::byte[m_blockSize * m_nBlocksPerSlab]);
+
+  // thread the new blocks onto the free list, in address order
+  for (size_t i = m_nBlocksPerSlab; i > 0; --i) {
+    auto block = reinterpret_cast<FreeBlock*>(slab.get() + (i - 1) * m_blockSize);
+    block->next = m_freeList;
+    m_freeList = block;
+  }
+}
+
+void*
+MemoryPool::allocate(size_t size)
+{
+  if (size > MAX_POOLED_SIZE || size == 0) {
+    return ::operator new(size);
+  }
+
+  auto& pool = m_pools[getSizeClass(size)];
+  if (pool == nullptr) {
+    pool = make_unique<FixedSizePool>(size);
+  }
+  return pool->allocate();
+}
+
+void
+MemoryPool::deallocate(void* p, size_t size) noexcept
+{
+  if (size > MAX_POOLED_SIZE || size == 0) {
+    ::operator delete(p);
+    return;
+  }
+
+  auto& pool = m_pools[getSizeClass(size)];
+  BOOST_ASSERT(pool != nullptr);
+  pool->deallocate(p);
+}
+
+size_t
+MemoryPool::getNAllocated() const noexcept
+{
+  size_t n = 0;
+  for (const auto& pool : m_pools) {
+    if (pool != nullptr) {
+      n += pool->getNAllocated();
+    }
+  }
+  return n;
+}
+
+} // namespace nfd
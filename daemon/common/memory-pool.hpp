@@ -0,0 +1,235 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_MEMORY_POOL_HPP
+#define NFD_DAEMON_COMMON_MEMORY_POOL_HPP
+
+#include "core/common.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace nfd {
+
+/**
+ * \brief A pool of memory blocks of a fixed size.
+ *
+ * Blocks are carved out of large slabs obtained from the system allocator, and freed blocks
+ * are kept in a free list for reuse. Once the pool has grown to its working set, allocate()
+ * and deallocate() no longer call the system allocator. Slabs are returned to the system
+ * only when the pool is destroyed.
+ */
+class FixedSizePool : noncopyable
+{
+public:
+  /**
+   * \param blockSize size of each block, which is rounded up to a multiple of
+   *                  `alignof(std::max_align_t)`
+   * \param nBlocksPerSlab number of blocks obtained from the system allocator at a time
+   */
+  explicit
+  FixedSizePool(size_t blockSize, size_t nBlocksPerSlab = DEFAULT_BLOCKS_PER_SLAB);
+
+  /**
+   * \brief Returns the (rounded up) size of each block.
+   */
+  size_t
+  getBlockSize() const noexcept
+  {
+    return m_blockSize;
+  }
+
+  /**
+   * \brief Returns the number of blocks currently allocated from this pool.
+   */
+  size_t
+  getNAllocated() const noexcept
+  {
+    return m_nAllocated;
+  }
+
+  /**
+   * \brief Returns the number of slabs obtained from the system allocator.
+   */
+  size_t
+  getNSlabs() const noexcept
+  {
+    return m_slabs.size();
+  }
+
+  /**
+   * \brief Allocates a block.
+   * \throw std::bad_alloc the system allocator failed to provide a new slab
+   */
+  void*
+  allocate();
+
+  /**
+   * \brief Returns a block to the pool.
+   * \pre \p block was obtained from allocate() of this pool, and has not been deallocated
+   */
+  void
+  deallocate(void* block) noexcept;
+
+public:
+  static constexpr size_t DEFAULT_BLOCKS_PER_SLAB = 256;
+
+private:
+  void
+  grow();
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  const size_t m_blockSize;
+  const size_t m_nBlocksPerSlab;
+  std::vector<unique_ptr<std::byte[]>> m_slabs;
+  FreeBlock* m_freeList = nullptr;
+  size_t m_nAllocated = 0;
+};
+
+/**
+ * \brief A set of FixedSizePool instances, one for each size class.
+ *
+ * Requests are rounded up to a multiple of #GRANULARITY and served from the pool of that
+ * size class, which is created on first use. Requests larger than #MAX_POOLED_SIZE are
+ * forwarded to the system allocator.
+ */
+class MemoryPool : noncopyable
+{
+public:
+  /**
+   * \brief Allocates \p size bytes, aligned to `alignof(std::max_align_t)`.
+   */
+  void*
+  allocate(size_t size);
+
+  /**
+   * \brief Deallocates memory obtained from allocate().
+   * \param size the size passed to allocate()
+   */
+  void
+  deallocate(void* p, size_t size) noexcept;
+
+  /**
+   * \brief Returns the number of blocks currently allocated from the pools.
+   * \note Requests forwarded to the system allocator are not counted.
+   */
+  size_t
+  getNAllocated() const noexcept;
+
+public:
+  static constexpr size_t GRANULARITY = alignof(std::max_align_t);
+  static constexpr size_t MAX_POOLED_SIZE = 1024;
+
+private:
+  static constexpr size_t
+  getSizeClass(size_t size) noexcept
+  {
+    return (size + GRANULARITY - 1) / GRANULARITY - 1;
+  }
+
+private:
+  std::array<unique_ptr<FixedSizePool>, MAX_POOLED_SIZE / GRANULARITY> m_pools;
+};
+
+/**
+ * \brief A standard allocator that obtains memory from a MemoryPool.
+ *
+ * The allocator shares the ownership of the MemoryPool, so that the pool outlives every object
+ * allocated from it, even if the owner of the pool (e.g., a table) is destroyed first.
+ * A default-constructed allocator, or one constructed with a null pool, uses the system allocator.
+ */
+template<typename T>
+class PoolAllocator
+{
+public:
+  using value_type = T;
+
+  PoolAllocator() noexcept = default;
+
+  explicit
+  PoolAllocator(shared_ptr<MemoryPool> pool) noexcept
+    : m_pool(std::move(pool))
+  {
+  }
+
+  template<typename U>
+  PoolAllocator(const PoolAllocator<U>& other) noexcept
+    : m_pool(other.getPool())
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    static_assert(alignof(T) <= MemoryPool::GRANULARITY, "over-aligned types are not supported");
+    if (m_pool == nullptr) {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(m_pool->allocate(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n) noexcept
+  {
+    if (m_pool == nullptr) {
+      ::operator delete(p);
+    }
+    else {
+      m_pool->deallocate(p, n * sizeof(T));
+    }
+  }
+
+  const shared_ptr<MemoryPool>&
+  getPool() const noexcept
+  {
+    return m_pool;
+  }
+
+  template<typename U>
+  friend bool
+  operator==(const PoolAllocator& lhs, const PoolAllocator<U>& rhs) noexcept
+  {
+    return lhs.m_pool == rhs.getPool();
+  }
+
+  template<typename U>
+  friend bool
+  operator!=(const PoolAllocator& lhs, const PoolAllocator<U>& rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+private:
+  shared_ptr<MemoryPool> m_pool;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_MEMORY_POOL_HPP
@@ -0,0 +1,267 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "timer-wheel.hpp"
+#include "common/global.hpp"
+
+#include <limits>
+
+namespace nfd {
+
+constexpr uint64_t SLOT_MASK = TimerWheel::N_SLOTS - 1;
+/// timers expiring at least this many ticks later are parked in the last level
+constexpr uint64_t MAX_DELTA = uint64_t(1) << (TimerWheel::LEVEL_BITS * TimerWheel::N_LEVELS);
+
+void
+TimerWheel::Timer::cancel() noexcept
+{
+  if (m_wheel != nullptr) {
+    m_wheel->cancel(*this);
+  }
+}
+
+TimerWheel::TimerWheel(time::nanoseconds granularity)
+  : m_granularity(granularity)
+  , m_epoch(time::steady_clock::now())
+{
+  BOOST_ASSERT(m_granularity > 0_ns);
+}
+
+TimerWheel::~TimerWheel()
+{
+  for (auto& level : m_slots) {
+    for (Timer*& head : level) {
+      while (head != nullptr) {
+        // releasing the callback may destroy other timers, which unlink themselves
+        cancel(*head);
+      }
+    }
+  }
+}
+
+void
+TimerWheel::schedule(Timer& timer, time::nanoseconds after, std::function<void()> callback)
+{
+  BOOST_ASSERT(callback);
+  timer.cancel();
+
+  auto now = time::steady_clock::now();
+  if (m_size == 0) {
+    // nothing to fire in between, catch up without walking the slots
+    m_now = std::max(m_now, toTick(now, false));
+  }
+
+  // a timer is never put into the slot being processed, so that a callback that re-arms
+  // its own timer with a zero delay cannot cause an infinite loop
+  timer.m_expiry = std::max(toTick(now + std::max(after, 0_ns), true), m_now + 1);
+  timer.m_callback = std::move(callback);
+  timer.m_wheel = this;
+  link(timer);
+  ++m_size;
+
+  rearm();
+}
+
+void
+TimerWheel::cancel(Timer& timer) noexcept
+{
+  BOOST_ASSERT(timer.m_wheel == this);
+  unlink(timer);
+  --m_size;
+  // the callback may own the timer, so it must be released last
+  auto callback = std::move(timer.m_callback);
+  timer.m_callback = nullptr;
+}
+
+uint64_t
+TimerWheel::toTick(time::steady_clock::time_point t, bool roundUp) const
+{
+  if (t <= m_epoch) {
+    return 0;
+  }
+  auto elapsed = time::duration_cast<time::nanoseconds>(t - m_epoch).count();
+  auto granularity = m_granularity.count();
+  uint64_t tick = static_cast<uint64_t>(elapsed / granularity);
+  if (roundUp && elapsed % granularity != 0) {
+    ++tick;
+  }
+  return tick;
+}
+
+void
+TimerWheel::link(Timer& timer)
+{
+  uint64_t delta = timer.m_expiry - m_now;
+  uint64_t placement = timer.m_expiry;
+  size_t level = 0;
+  if (delta >= MAX_DELTA) {
+    placement = m_now + MAX_DELTA - 1;
+    level = N_LEVELS - 1;
+  }
+  else {
+    while (delta >= (uint64_t(1) << (LEVEL_BITS * (level + 1)))) {
+      ++level;
+    }
+  }
+  size_t slot = (placement >> (LEVEL_BITS * level)) & SLOT_MASK;
+
+  Timer*& head = m_slots[level][slot];
+  timer.m_level = static_cast<uint8_t>(level);
+  timer.m_slot = static_cast<uint8_t>(slot);
+  timer.m_prev = nullptr;
+  timer.m_next = head;
+  if (head != nullptr) {
+    head->m_prev = &timer;
+  }
+  head = &timer;
+  m_occupied[level] |= uint64_t(1) << slot;
+}
+
+void
+TimerWheel::unlink(Timer& timer) noexcept
+{
+  if (timer.m_prev != nullptr) {
+    timer.m_prev->m_next = timer.m_next;
+  }
+  else {
+    m_slots[timer.m_level][timer.m_slot] = timer.m_next;
+    if (timer.m_next == nullptr) {
+      m_occupied[timer.m_level] &= ~(uint64_t(1) << timer.m_slot);
+    }
+  }
+  if (timer.m_next != nullptr) {
+    timer.m_next->m_prev = timer.m_prev;
+  }
+  timer.m_prev = timer.m_next = nullptr;
+  timer.m_wheel = nullptr;
+}
+
+void
+TimerWheel::advance(uint64_t target)
+{
+  while (m_now < target) {
+    if (m_size == 0) {
+      m_now = target;
+      break;
+    }
+
+    if (m_occupied[0] == 0) {
+      // skip empty slots up to the next cascade
+      m_now = std::min(target, (m_now | SLOT_MASK) + 1);
+    }
+    else {
+      ++m_now;
+    }
+
+    for (size_t level = 1; level < N_LEVELS; ++level) {
+      size_t shift = LEVEL_BITS * level;
+      if ((m_now & ((uint64_t(1) << shift) - 1)) != 0) {
+        break;
+      }
+      cascade(level, (m_now >> shift) & SLOT_MASK);
+    }
+    expire(m_now & SLOT_MASK);
+  }
+}
+
+void
+TimerWheel::cascade(size_t level, size_t slot)
+{
+  Timer* timer = m_slots[level][slot];
+  m_slots[level][slot] = nullptr;
+  m_occupied[level] &= ~(uint64_t(1) << slot);
+
+  while (timer != nullptr) {
+    Timer* next = timer->m_next;
+    link(*timer);
+    timer = next;
+  }
+}
+
+void
+TimerWheel::expire(size_t slot)
+{
+  // callbacks may arm or cancel other timers in this slot, so take one at a time
+  Timer*& head = m_slots[0][slot];
+  while (head != nullptr) {
+    Timer& timer = *head;
+    BOOST_ASSERT(timer.m_expiry == m_now);
+    unlink(timer);
+    --m_size;
+    auto callback = std::move(timer.m_callback);
+    timer.m_callback = nullptr;
+    callback();
+  }
+}
+
+uint64_t
+TimerWheel::getNextTick() const
+{
+  uint64_t next = std::numeric_limits<uint64_t>::max();
+  for (size_t level = 0; level < N_LEVELS; ++level) {
+    if (m_occupied[level] == 0) {
+      continue;
+    }
+    // a slot of level 0 is processed at its tick, and a slot of a higher level is cascaded
+    // at the start of its period; the slot of the current period, if occupied, belongs to
+    // the period N_SLOTS later
+    size_t shift = LEVEL_BITS * level;
+    for (uint64_t period = (m_now >> shift) + 1; ; ++period) {
+      if (m_occupied[level] & (uint64_t(1) << (period & SLOT_MASK))) {
+        next = std::min(next, period << shift);
+        break;
+      }
+    }
+  }
+  return next;
+}
+
+void
+TimerWheel::rearm()
+{
+  if (m_size == 0) {
+    return;
+  }
+
+  uint64_t next = getNextTick();
+  if (m_armedTick && *m_armedTick <= next) {
+    return;
+  }
+
+  m_armedTick = next;
+  auto delay = m_epoch + m_granularity * static_cast<int64_t>(next) - time::steady_clock::now();
+  m_tickEvent = getScheduler().schedule(std::max(time::duration_cast<time::nanoseconds>(delay), 0_ns),
+                                        [this] { onTick(); });
+}
+
+void
+TimerWheel::onTick()
+{
+  m_armedTick = std::nullopt;
+  advance(toTick(time::steady_clock::now(), false));
+  rearm();
+}
+
+} // namespace nfd
@@ -0,0 +1,194 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
+#define NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <array>
+#include <functional>
+
+namespace nfd {
+
+/**
+ * \brief A hierarchical timing wheel.
+ *
+ * Timers are intrusive: the storage of each timer is provided by its owner, and the wheel
+ * only links it into one of its slots. Therefore, arming and canceling a timer take constant
+ * time and do not allocate memory (other than what the callback itself may need).
+ *
+ * Time is divided into ticks of a fixed granularity. A timer expires at the first tick that
+ * is not earlier than its deadline, so it may fire up to one granularity late, but never early.
+ * The wheel has #N_LEVELS levels of #N_SLOTS slots each, so that timers expiring within
+ * N_SLOTS ^ N_LEVELS ticks are cascaded at most N_LEVELS - 1 times; timers expiring later
+ * are parked in the last level and cascaded again as needed.
+ *
+ * The wheel is driven by a single event of the global Scheduler, which is scheduled only
+ * when some timer is pending, at the next tick that needs attention.
+ */
+class TimerWheel : noncopyable
+{
+public:
+  /**
+   * \brief A timer that can be armed on a TimerWheel.
+   *
+   * The timer is canceled when it is destroyed.
+   */
+  class Timer : noncopyable
+  {
+  public:
+    Timer() noexcept = default;
+
+    ~Timer()
+    {
+      cancel();
+    }
+
+    /**
+     * \brief Returns whether the timer is armed and has not yet fired.
+     */
+    bool
+    isPending() const noexcept
+    {
+      return m_wheel != nullptr;
+    }
+
+    /**
+     * \brief Cancels the timer if it is pending.
+     */
+    void
+    cancel() noexcept;
+
+  private:
+    TimerWheel* m_wheel = nullptr;
+    Timer* m_prev = nullptr;
+    Timer* m_next = nullptr;
+    uint64_t m_expiry = 0; ///< in ticks
+    uint8_t m_level = 0;
+    uint8_t m_slot = 0;
+    std::function<void()> m_callback;
+
+    friend TimerWheel;
+  };
+
+  explicit
+  TimerWheel(time::nanoseconds granularity = DEFAULT_GRANULARITY);
+
+  /**
+   * \brief Cancels all pending timers.
+   */
+  ~TimerWheel();
+
+  /**
+   * \brief Arms \p timer to invoke \p callback after \p after.
+   *
+   * If \p timer is already pending, it is canceled first.
+   */
+  void
+  schedule(Timer& timer, time::nanoseconds after, std::function<void()> callback);
+
+  /**
+   * \brief Returns the number of pending timers.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  time::nanoseconds
+  getGranularity() const noexcept
+  {
+    return m_granularity;
+  }
+
+public:
+  static constexpr time::nanoseconds DEFAULT_GRANULARITY = 1_ms;
+  static constexpr size_t LEVEL_BITS = 6;
+  static constexpr size_t N_SLOTS = size_t(1) << LEVEL_BITS;
+  static constexpr size_t N_LEVELS = 4;
+
+private:
+  uint64_t
+  toTick(time::steady_clock::time_point t, bool roundUp) const;
+
+  void
+  link(Timer& timer);
+
+  void
+  unlink(Timer& timer) noexcept;
+
+  void
+  cancel(Timer& timer) noexcept;
+
+  /** \brief Processes all ticks up to and including \p target.
+   */
+  void
+  advance(uint64_t target);
+
+  /** \brief Moves the timers in a slot of a higher level to lower levels.
+   */
+  void
+  cascade(size_t level, size_t slot);
+
+  /** \brief Fires the timers in a slot of level 0.
+   */
+  void
+  expire(size_t slot);
+
+  /** \brief Returns the earliest tick at which the wheel must be advanced.
+   */
+  uint64_t
+  getNextTick() const;
+
+  /** \brief Ensures the scheduler event is scheduled no later than getNextTick().
+   */
+  void
+  rearm();
+
+  void
+  onTick();
+
+private:
+  const time::nanoseconds m_granularity;
+  const time::steady_clock::time_point m_epoch;
+  uint64_t m_now = 0; ///< last processed tick
+  size_t m_size = 0;
+
+  std::array<std::array<Timer*, N_SLOTS>, N_LEVELS> m_slots{};
+  /// bit i of m_occupied[level] is set if m_slots[level][i] is not empty
+  std::array<uint64_t, N_LEVELS> m_occupied{};
+  static_assert(N_SLOTS <= 64);
+
+  ndn::scheduler::ScopedEventId m_tickEvent;
+  std::optional<uint64_t> m_armedTick;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_COMMON_TIMER_WHEEL_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -30,7 +30,9 @@
 #include "socket-utils.hpp"
 #include "common/global.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cerrno>
 
 #include <boost/asio/defer.hpp>
 
@@ -60,28 +62,90 @@ public:
   explicit
   DatagramTransport(typename protocol::socket&& socket);
 
+  /**
+   * \brief Returns the number of bytes in the send buffer of the socket used for sending,
+   *        plus the bytes of the packets queued in the transport but not yet handed to it.
+   */
   ssize_t
   getSendQueueLength() override;
 
+  /**
+   * \brief Counters of the batched send path.
+   *
+   * The average batch size is nSentPackets / nSendBatches.
+   */
+  struct SendBatchCounters
+  {
+    uint64_t nSendBatches = 0; ///< number of times the send queue was flushed
+    uint64_t nSentPackets = 0; ///< number of packets sent from the send queue
+    uint64_t maxBatchSize = 0; ///< largest number of packets flushed at once
+  };
+
+  const SendBatchCounters&
+  getSendBatchCounters() const noexcept
+  {
+    return m_sendBatchCounters;
+  }
+
   /**
    * \brief Receive datagram, translate buffer into packet, deliver to parent class.
+   * \param buffer the buffer holding the datagram at its beginning
+   * \param nBytes size of the datagram
    */
   void
-  receiveDatagram(span<const uint8_t> buffer, const boost::system::error_code& error);
+  receiveDatagram(const ReceiveBuffer& buffer, size_t nBytes, const boost::system::error_code& error);
 
 protected:
   void
   doClose() override;
 
+  /**
+   * \brief Queues a packet for sending.
+   *
+   * Packets queued during one turn of the event loop are flushed together afterwards,
+   * see flushSendQueue(). If the queued packets would exceed the send queue capacity,
+   * the packet is dropped and counted in nOutDropped.
+   */
   void
   doSend(const Block& packet) override;
 
+  /**
+   * \brief Sets the socket and destination used for sending.
+   *
+   * By default, packets are sent on m_socket, which must be connected.
+   */
+  void
+  setTxSocket(typename protocol::socket& socket, const typename protocol::endpoint& destination);
+
+  /**
+   * \brief Sends all queued packets, with one system call per batch where supported.
+   *
+   * If the socket buffer is full, the unsent packets stay queued in order, and sending
+   * resumes when the socket becomes writable. A packet that fails with any other error is
+   * dropped; if the error also brings the transport down, the remaining packets are dropped.
+   * Dropped packets are counted in nOutDropped.
+   */
+  void
+  flushSendQueue();
+
+  /**
+   * \brief Drops the packets that are still queued, counting them in nOutDropped.
+   */
   void
-  handleSend(const boost::system::error_code& error, size_t nBytesSent);
+  dropSendQueue();
 
   void
   handleReceive(const boost::system::error_code& error, size_t nBytesReceived);
 
+  /**
+   * \brief Receives and delivers the datagrams already queued on the socket, if any.
+   *
+   * This is invoked after each completed asynchronous receive, so that a burst of datagrams
+   * is delivered with one handler dispatch and few system calls.
+   */
+  void
+  receiveQueuedDatagrams();
+
   void
   processErrorCode(const boost::system::error_code& error);
 
@@ -98,8 +162,14 @@ protected:
   NFD_LOG_MEMBER_DECL();
 
 private:
-  std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
+  ReceiveBuffer m_receiveBuffer;
   bool m_hasRecentlyReceived = false;
+
+  typename protocol::socket* m_txSocket = &m_socket;
+  std::optional<typename protocol::endpoint> m_txDestination;
+  std::vector<Block> m_sendQueue;
+  size_t m_sendQueueBytes = 0; ///< total size of the packets in m_sendQueue
+  SendBatchCounters m_sendBatchCounters;
 };
 
 
@@ -118,7 +188,8 @@ DatagramTransport<T, U>::DatagramTransport(typename DatagramTransport::protocol:
     this->setSendQueueCapacity(sendBufferSizeOption.value());
   }
 
-  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
+  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer.data(), m_receiveBuffer.size()),
+                              m_sender,
                               [this] (auto&&... args) {
                                 this->handleReceive(std::forward<decltype(args)>(args)...);
                               });
@@ -128,10 +199,13 @@ template<class T, class U>
 ssize_t
 DatagramTransport<T, U>::getSendQueueLength()
 {
-  ssize_t queueLength = getTxQueueLength(m_socket.native_handle());
+  ssize_t queueLength = getTxQueueLength(m_txSocket->native_handle());
   if (queueLength == QUEUE_ERROR) {
     NFD_LOG_FACE_WARN("Failed to obtain send queue length from socket: " << std::strerror(errno));
   }
+  else if (queueLength >= 0) {
+    queueLength += static_cast<ssize_t>(m_sendQueueBytes);
+  }
   return queueLength;
 }
 
@@ -141,6 +215,13 @@ DatagramTransport<T, U>::doClose()
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+  if (getState() == TransportState::CLOSING) {
+    // hand the packets queued in this turn to the socket before it is closed;
+    // after a failure, the queue is dropped instead
+    flushSendQueue();
+  }
+  dropSendQueue();
+
   if (m_socket.is_open()) {
     // Cancel all outstanding operations and close the socket.
     // Use the non-throwing variants and ignore errors, if any.
@@ -162,30 +243,121 @@ DatagramTransport<T, U>::doSend(const Block& packet)
 {
   NFD_LOG_FACE_TRACE(__func__);
 
-  m_socket.async_send(boost::asio::buffer(packet),
-                      // 'packet' is copied into the lambda to retain the underlying Buffer
-                      [this, packet] (auto&&... args) {
-                        this->handleSend(std::forward<decltype(args)>(args)...);
-                      });
+  ssize_t capacity = getSendQueueCapacity();
+  if (capacity >= 0 && m_sendQueueBytes + packet.size() > static_cast<size_t>(capacity)) {
+    NFD_LOG_FACE_DEBUG("Send queue is full, dropping packet of " << packet.size() << " bytes");
+    ++this->nOutDropped;
+    return;
+  }
+
+  m_sendQueue.push_back(packet);
+  m_sendQueueBytes += packet.size();
+  if (m_sendQueue.size() == 1) {
+    // while the queue is not empty, a flush is either scheduled or waiting for the socket
+    // to become writable; doClose() flushes whatever is still queued
+    boost::asio::defer(getGlobalIoService(), [this] { flushSendQueue(); });
+  }
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::setTxSocket(typename protocol::socket& socket,
+                                     const typename protocol::endpoint& destination)
+{
+  m_txSocket = &socket;
+  m_txDestination = destination;
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::flushSendQueue()
+{
+  if (m_sendQueue.empty() || !m_txSocket->is_open()) {
+    dropSendQueue();
+    return;
+  }
+
+  const sockaddr* dest = m_txDestination ? m_txDestination->data() : nullptr;
+  socklen_t destLen = m_txDestination ? static_cast<socklen_t>(m_txDestination->size()) : 0;
+  auto popFront = [this] (size_t n) {
+    auto last = m_sendQueue.begin() + static_cast<std::ptrdiff_t>(n);
+    std::for_each(m_sendQueue.begin(), last, [this] (const Block& b) { m_sendQueueBytes -= b.size(); });
+    m_sendQueue.erase(m_sendQueue.begin(), last);
+  };
+
+  size_t nSentTotal = 0;
+  bool isWouldBlock = false;
+  while (!m_sendQueue.empty()) {
+    size_t nSent = sendDatagrams(m_txSocket->native_handle(), m_sendQueue, dest, destLen);
+    int errorCode = errno;
+    nSentTotal += nSent;
+    popFront(nSent);
+    if (m_sendQueue.empty()) {
+      break;
+    }
+    if (errorCode == EAGAIN || errorCode == EWOULDBLOCK || errorCode == ENOBUFS) {
+      isWouldBlock = true;
+      break;
+    }
+
+    // the packet at the front cannot be sent
+    NFD_LOG_FACE_DEBUG("Dropping packet of " << m_sendQueue.front().size() << " bytes: "
+                       << std::strerror(errorCode));
+    ++this->nOutDropped;
+    popFront(1);
+    // if the error brings the transport down, the remaining packets are dropped
+    processErrorCode(boost::system::error_code(errorCode, boost::system::system_category()));
+    if (!m_txSocket->is_open()) {
+      dropSendQueue();
+      break;
+    }
+  }
+
+  ++m_sendBatchCounters.nSendBatches;
+  m_sendBatchCounters.nSentPackets += nSentTotal;
+  m_sendBatchCounters.maxBatchSize = std::max<uint64_t>(m_sendBatchCounters.maxBatchSize, nSentTotal);
+  NFD_LOG_FACE_TRACE("Sent " << nSentTotal << " packets, " << m_sendQueue.size() << " still queued");
+
+  if (isWouldBlock) {
+    // socket buffer is full, keep the unsent packets in order and resume once it is writable
+    m_txSocket->async_wait(protocol::socket::wait_write, [this] (const auto& error) {
+      if (error) {
+        return processErrorCode(error);
+      }
+      flushSendQueue();
+    });
+  }
+}
+
+template<class T, class U>
+void
+DatagramTransport<T, U>::dropSendQueue()
+{
+  if (!m_sendQueue.empty()) {
+    NFD_LOG_FACE_DEBUG("Dropping " << m_sendQueue.size() << " queued packets");
+    this->nOutDropped += m_sendQueue.size();
+  }
+  m_sendQueue.clear();
+  m_sendQueueBytes = 0;
 }
 
 template<class T, class U>
 void
-DatagramTransport<T, U>::receiveDatagram(span<const uint8_t> buffer,
+DatagramTransport<T, U>::receiveDatagram(const ReceiveBuffer& buffer, size_t nBytes,
                                          const boost::system::error_code& error)
 {
   if (error)
     return processErrorCode(error);
 
-  NFD_LOG_FACE_TRACE("Received: " << buffer.size() << " bytes from " << m_sender);
+  NFD_LOG_FACE_TRACE("Received: " << nBytes << " bytes from " << m_sender);
 
-  auto [isOk, element] = Block::fromBuffer(buffer);
+  auto [isOk, element] = buffer.decode(0, nBytes);
   if (!isOk) {
     NFD_LOG_FACE_WARN("Failed to parse incoming packet from " << m_sender);
     // This packet won't extend the face lifetime
     return;
   }
-  if (element.size() != buffer.size()) {
+  if (element.size() != nBytes) {
     NFD_LOG_FACE_WARN("Received datagram size and decoded element size don't match");
     // This packet won't extend the face lifetime
     return;
@@ -202,23 +374,32 @@ template<class T, class U>
 void
 DatagramTransport<T, U>::handleReceive(const boost::system::error_code& error, size_t nBytesReceived)
 {
-  receiveDatagram(ndn::make_span(m_receiveBuffer).first(nBytesReceived), error);
+  receiveDatagram(m_receiveBuffer, nBytesReceived, error);
+
+  if (!error && m_socket.is_open())
+    receiveQueuedDatagrams();
 
-  if (m_socket.is_open())
-    m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
+  if (m_socket.is_open()) {
+    m_receiveBuffer.prepare();
+    m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer.data(), m_receiveBuffer.size()),
+                                m_sender,
                                 [this] (auto&&... args) {
                                   this->handleReceive(std::forward<decltype(args)>(args)...);
                                 });
+  }
 }
 
 template<class T, class U>
 void
-DatagramTransport<T, U>::handleSend(const boost::system::error_code& error, size_t nBytesSent)
+DatagramTransport<T, U>::receiveQueuedDatagrams()
 {
-  if (error)
-    return processErrorCode(error);
-
-  NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
+  auto& batch = getDatagramBatch();
+  size_t nReceived = batch.receive(m_socket.native_handle());
+  // stop if the transport is closed while processing a datagram
+  for (size_t i = 0; i < nReceived && m_socket.is_open(); ++i) {
+    batch.getSender(i, m_sender);
+    receiveDatagram(batch.getBuffer(i), batch.getPayloadLength(i), {});
+  }
 }
 
 template<class T, class U>
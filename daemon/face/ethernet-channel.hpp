@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -28,6 +28,7 @@
 
 #include "channel.hpp"
 #include "ethernet-protocol.hpp"
+#include "ethernet-transport.hpp"
 #include "pcap-helper.hpp"
 
 #include <boost/asio/posix/stream_descriptor.hpp>
@@ -57,9 +58,13 @@ public:
    *
    * To enable the creation of faces upon incoming connections, one needs to
    * explicitly call listen().
+   *
+   * \param backend I/O backend of the unicast faces created by this channel; the channel
+   *                itself always listens for new peers through libpcap
    */
   EthernetChannel(shared_ptr<const ndn::net::NetworkInterface> localEndpoint,
-                  time::nanoseconds idleTimeout);
+                  time::nanoseconds idleTimeout,
+                  EthernetBackend backend = EthernetBackend::PCAP);
 
   bool
   isListening() const final
@@ -128,6 +133,7 @@ private:
   PcapHelper m_pcap;
   std::map<ethernet::Address, shared_ptr<Face>> m_channelFaces;
   const time::nanoseconds m_idleFaceTimeout; ///< Timeout for automatic closure of idle on-demand faces
+  const EthernetBackend m_backend;
 
 #ifndef NDEBUG
   /// Number of frames dropped by the kernel, as reported by libpcap
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -59,6 +59,7 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
   // {
   //   listen yes
   //   idle_timeout 600
+  //   io_backend pcap
   //   mcast yes
   //   mcast_group 01:00:5E:00:17:AA
   //   mcast_ad_hoc no
@@ -73,6 +74,7 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
 
   UnicastConfig unicastConfig;
   MulticastConfig mcastConfig;
+  EthernetBackend backend = EthernetBackend::PCAP;
 
   if (configSection) {
     // listen and mcast default to 'yes' but only if face_system.ether section is present
@@ -88,6 +90,24 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
       else if (key == "idle_timeout") {
         unicastConfig.idleTimeout = time::seconds(ConfigFile::parseNumber<uint32_t>(pair, "face_system.ether"));
       }
+      else if (key == "io_backend") {
+        const std::string& valueStr = value.get_value<std::string>();
+        if (valueStr == "pcap") {
+          backend = EthernetBackend::PCAP;
+        }
+        else if (valueStr == "tpacket_v3") {
+#if defined(__linux__)
+          backend = EthernetBackend::TPACKET_V3;
+#else
+          NDN_THROW(ConfigFile::Error("face_system.ether.io_backend: '" +
+                                      valueStr + "' is not supported on this platform"));
+#endif
+        }
+        else {
+          NDN_THROW(ConfigFile::Error("face_system.ether.io_backend: '" +
+                                      valueStr + "' is not a known backend"));
+        }
+      }
       else if (key == "mcast") {
         mcastConfig.isEnabled = ConfigFile::parseYesNo(pair, "face_system.ether");
       }
@@ -135,6 +155,10 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
     NFD_LOG_WARN("Cannot disable Ethernet channels after initialization");
   }
 
+  if (m_backend != backend && (!m_channels.empty() || !m_mcastFaces.empty())) {
+    NFD_LOG_WARN("I/O backend " << backend << " applies to new Ethernet channels and faces only");
+  }
+
   if (m_mcastConfig.isEnabled != mcastConfig.isEnabled) {
     if (mcastConfig.isEnabled) {
       NFD_LOG_INFO("enabling multicast on " << mcastConfig.group);
@@ -160,6 +184,7 @@ EthernetFactory::doProcessConfig(OptionalConfigSection configSection,
   // the configuration because netifs may have changed.
   m_unicastConfig = std::move(unicastConfig);
   m_mcastConfig = std::move(mcastConfig);
+  m_backend = backend;
   applyConfig(context);
 }
 
@@ -216,13 +241,14 @@ EthernetFactory::doCreateFace(const CreateFaceRequest& req,
 
 shared_ptr<EthernetChannel>
 EthernetFactory::createChannel(const shared_ptr<const ndn::net::NetworkInterface>& localEndpoint,
-                               time::nanoseconds idleTimeout)
+                               time::nanoseconds idleTimeout,
+                               EthernetBackend backend)
 {
   auto it = m_channels.find(localEndpoint->getName());
   if (it != m_channels.end())
     return it->second;
 
-  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout);
+  auto channel = std::make_shared<EthernetChannel>(localEndpoint, idleTimeout, backend);
   m_channels[localEndpoint->getName()] = channel;
   return channel;
 }
@@ -250,7 +276,7 @@ EthernetFactory::createMulticastFace(const ndn::net::NetworkInterface& netif,
   opts.allowReassembly = true;
 
   auto linkService = make_unique<GenericLinkService>(opts);
-  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType);
+  auto transport = make_unique<MulticastEthernetTransport>(netif, address, m_mcastConfig.linkType, m_backend);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
 
   m_mcastFaces[key] = face;
@@ -286,7 +312,7 @@ EthernetFactory::applyUnicastConfigToNetif(const shared_ptr<const ndn::net::Netw
     return nullptr;
   }
 
-  auto channel = this->createChannel(netif, m_unicastConfig.idleTimeout);
+  auto channel = this->createChannel(netif, m_unicastConfig.idleTimeout, m_backend);
   if (m_unicastConfig.wantListen && !channel->isListening()) {
     try {
       channel->listen(this->addFace, nullptr);
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -56,7 +56,8 @@ public:
    */
   shared_ptr<EthernetChannel>
   createChannel(const shared_ptr<const ndn::net::NetworkInterface>& localEndpoint,
-                time::nanoseconds idleTimeout);
+                time::nanoseconds idleTimeout,
+                EthernetBackend backend = EthernetBackend::PCAP);
 
   /**
    * \brief Create a face to communicate on the given Ethernet multicast group.
@@ -124,6 +125,8 @@ private:
   };
   MulticastConfig m_mcastConfig;
 
+  EthernetBackend m_backend = EthernetBackend::PCAP;
+
   // [ifname, group] => face
   std::map<std::pair<std::string, ethernet::Address>, shared_ptr<Face>> m_mcastFaces;
 
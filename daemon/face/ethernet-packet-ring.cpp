@@ -0,0 +1,301 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ethernet-packet-ring.hpp"
+#include "ethernet-protocol.hpp"
+
+#if defined(__linux__)
+
+#include "common/privilege-helper.hpp"
+
+#include <pcap/pcap.h>
+
+#include <cerrno>              // for errno
+#include <cstring>             // for strerror()
+#include <linux/filter.h>      // for struct sock_fprog
+#include <linux/if_packet.h>   // for struct tpacket_req3, struct tpacket3_hdr
+#include <sys/mman.h>          // for mmap(), munmap()
+#include <sys/socket.h>        // for socket(), setsockopt(), sendto()
+#include <unistd.h>            // for close(), dup()
+
+#include <boost/endian/conversion.hpp>
+
+#if !defined(PCAP_NETMASK_UNKNOWN)
+#define PCAP_NETMASK_UNKNOWN  0xffffffff
+#endif
+
+namespace nfd::face {
+
+// RX ring: frames are packed back to back into blocks, a block is handed to userspace
+// when it is full or when the retire timeout expires, whichever happens first
+constexpr unsigned int RX_BLOCK_SIZE = 1 << 20;
+constexpr unsigned int RX_BLOCK_COUNT = 4;
+constexpr unsigned int RX_FRAME_SIZE = 2048; // nominal only, TPACKET_V3 frames have variable size
+constexpr unsigned int RX_RETIRE_TIMEOUT = 1; // milliseconds, upper bound on added latency
+
+// TX ring: fixed-size slots, each large enough for the largest NDN packet
+constexpr unsigned int TX_FRAME_SIZE = 1 << 14;
+constexpr unsigned int TX_BLOCK_SIZE = 1 << 16;
+constexpr unsigned int TX_BLOCK_COUNT = 64;
+constexpr unsigned int TX_FRAME_COUNT = TX_BLOCK_COUNT * (TX_BLOCK_SIZE / TX_FRAME_SIZE);
+constexpr size_t TX_DATA_OFFSET = TPACKET_ALIGN(sizeof(tpacket3_hdr));
+
+static_assert(TX_FRAME_SIZE - TX_DATA_OFFSET >= ethernet::HDR_LEN + ndn::MAX_NDN_PACKET_SIZE,
+              "TX_FRAME_SIZE is too small");
+
+PacketRing::PacketRing(int interfaceIndex, uint16_t ethertype)
+  : m_interfaceIndex(interfaceIndex)
+  , m_ethertype(ethertype)
+{
+  // protocol 0 means that no frames are received until the socket is bound, see setPacketFilter()
+  int errorCode = 0;
+  PrivilegeHelper::runElevated([this, &errorCode] {
+    m_fd = ::socket(AF_PACKET, SOCK_RAW, 0);
+    errorCode = errno;
+  });
+  if (m_fd < 0)
+    NDN_THROW(Error("socket: "s + std::strerror(errorCode)));
+
+  auto setOption = [this] (int name, const auto& value, const char* what) {
+    if (::setsockopt(m_fd, SOL_PACKET, name, &value, sizeof(value)) < 0) {
+      int errorCode = errno;
+      close();
+      NDN_THROW(Error("setsockopt(" + std::string(what) + "): " + std::strerror(errorCode)));
+    }
+  };
+
+  int version = TPACKET_V3;
+  setOption(PACKET_VERSION, version, "PACKET_VERSION");
+
+#if defined(PACKET_IGNORE_OUTGOING)
+  int ignoreOutgoing = 1;
+  setOption(PACKET_IGNORE_OUTGOING, ignoreOutgoing, "PACKET_IGNORE_OUTGOING");
+#endif
+
+  tpacket_req3 rxReq{};
+  rxReq.tp_block_size = RX_BLOCK_SIZE;
+  rxReq.tp_block_nr = RX_BLOCK_COUNT;
+  rxReq.tp_frame_size = RX_FRAME_SIZE;
+  rxReq.tp_frame_nr = RX_BLOCK_COUNT * (RX_BLOCK_SIZE / RX_FRAME_SIZE);
+  rxReq.tp_retire_blk_tov = RX_RETIRE_TIMEOUT;
+  setOption(PACKET_RX_RING, rxReq, "PACKET_RX_RING");
+
+  // the kernel rejects TX rings with a retire timeout, private area, or feature request
+  tpacket_req3 txReq{};
+  txReq.tp_block_size = TX_BLOCK_SIZE;
+  txReq.tp_block_nr = TX_BLOCK_COUNT;
+  txReq.tp_frame_size = TX_FRAME_SIZE;
+  txReq.tp_frame_nr = TX_FRAME_COUNT;
+  setOption(PACKET_TX_RING, txReq, "PACKET_TX_RING");
+
+  // both rings are mapped with a single mmap(2) call, RX ring first
+  m_mapSize = size_t{RX_BLOCK_SIZE} * RX_BLOCK_COUNT + size_t{TX_BLOCK_SIZE} * TX_BLOCK_COUNT;
+  void* map = ::mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (map == MAP_FAILED) {
+    errorCode = errno;
+    close();
+    NDN_THROW(Error("mmap: "s + std::strerror(errorCode)));
+  }
+  m_map = static_cast<uint8_t*>(map);
+}
+
+PacketRing::~PacketRing() noexcept
+{
+  close();
+}
+
+void
+PacketRing::close() noexcept
+{
+  if (m_map) {
+    ::munmap(m_map, m_mapSize);
+    m_map = nullptr;
+  }
+  if (m_fd >= 0) {
+    ::close(m_fd);
+    m_fd = -1;
+  }
+  m_rxBlock = nullptr;
+  m_nRxRemaining = 0;
+  m_nTxQueued = 0;
+}
+
+int
+PacketRing::getFd() const
+{
+  int fd = ::dup(m_fd);
+  if (fd < 0)
+    NDN_THROW(Error("dup: "s + std::strerror(errno)));
+  return fd;
+}
+
+size_t
+PacketRing::getNDropped()
+{
+  // the kernel resets the counters every time they are read
+  tpacket_stats_v3 stats{};
+  socklen_t len = sizeof(stats);
+  if (::getsockopt(m_fd, SOL_PACKET, PACKET_STATISTICS, &stats, &len) < 0)
+    NDN_THROW(Error("getsockopt(PACKET_STATISTICS): "s + std::strerror(errno)));
+
+  m_nDropped += stats.tp_drops;
+  return m_nDropped;
+}
+
+void
+PacketRing::setPacketFilter(const char* filter)
+{
+  pcap_t* dead = pcap_open_dead(DLT_EN10MB, ethernet::HDR_LEN + ndn::MAX_NDN_PACKET_SIZE);
+  if (!dead)
+    NDN_THROW(Error("pcap_open_dead failed"));
+
+  bpf_program prog;
+  if (pcap_compile(dead, &prog, filter, 1, PCAP_NETMASK_UNKNOWN) < 0) {
+    std::string msg = pcap_geterr(dead);
+    pcap_close(dead);
+    NDN_THROW(Error("pcap_compile: " + msg));
+  }
+  pcap_close(dead);
+
+  // struct bpf_insn and struct sock_filter have the same layout
+  sock_fprog fprog{};
+  fprog.len = static_cast<unsigned short>(prog.bf_len);
+  fprog.filter = reinterpret_cast<sock_filter*>(prog.bf_insns);
+  int ret = ::setsockopt(m_fd, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog));
+  int errorCode = errno;
+  pcap_freecode(&prog);
+  if (ret < 0)
+    NDN_THROW(Error("setsockopt(SO_ATTACH_FILTER): "s + std::strerror(errorCode)));
+
+  if (m_isBound)
+    return;
+
+  sockaddr_ll addr{};
+  addr.sll_family = AF_PACKET;
+  addr.sll_protocol = boost::endian::native_to_big(m_ethertype);
+  addr.sll_ifindex = m_interfaceIndex;
+  if (::bind(m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+    NDN_THROW(Error("bind: "s + std::strerror(errno)));
+  m_isBound = true;
+}
+
+std::tuple<span<const uint8_t>, std::string>
+PacketRing::readNextPacket() noexcept
+{
+  while (true) {
+    if (m_nRxRemaining == 0) {
+      if (m_rxBlock != nullptr) {
+        // the previously returned frame is no longer in use, give the whole block back
+        auto* desc = reinterpret_cast<tpacket_block_desc*>(m_rxBlock);
+        __atomic_store_n(&desc->hdr.bh1.block_status, TP_STATUS_KERNEL, __ATOMIC_RELEASE);
+        m_rxBlock = nullptr;
+        m_rxBlockIndex = (m_rxBlockIndex + 1) % RX_BLOCK_COUNT;
+      }
+
+      uint8_t* block = getRxBlock(m_rxBlockIndex);
+      auto* desc = reinterpret_cast<tpacket_block_desc*>(block);
+      if ((__atomic_load_n(&desc->hdr.bh1.block_status, __ATOMIC_ACQUIRE) & TP_STATUS_USER) == 0)
+        return {span<uint8_t>{}, "Nothing to read"};
+
+      m_rxBlock = block;
+      m_rxFrame = block + desc->hdr.bh1.offset_to_first_pkt;
+      m_nRxRemaining = desc->hdr.bh1.num_pkts;
+      continue;
+    }
+
+    auto* hdr = reinterpret_cast<const tpacket3_hdr*>(m_rxFrame);
+    m_rxFrame += hdr->tp_next_offset;
+    --m_nRxRemaining;
+
+    // the BPF program generated by pcap_open_dead() cannot see VLAN tags that were
+    // stripped into packet metadata, so "not vlan" is enforced here instead
+    auto* sll = reinterpret_cast<const sockaddr_ll*>(reinterpret_cast<const uint8_t*>(hdr) +
+                                                     TPACKET_ALIGN(sizeof(tpacket3_hdr)));
+    if (sll->sll_pkttype == PACKET_OUTGOING || (hdr->tp_status & TP_STATUS_VLAN_VALID) != 0)
+      continue;
+
+    return {{reinterpret_cast<const uint8_t*>(hdr) + hdr->tp_mac, hdr->tp_snaplen}, ""};
+  }
+}
+
+span<uint8_t>
+PacketRing::getTxSlot() const noexcept
+{
+  uint8_t* frame = getTxFrame(m_txFrameIndex);
+  auto* hdr = reinterpret_cast<tpacket3_hdr*>(frame);
+  auto status = __atomic_load_n(&hdr->tp_status, __ATOMIC_ACQUIRE);
+  if (status != TP_STATUS_AVAILABLE && status != TP_STATUS_WRONG_FORMAT)
+    return {};
+
+  return {frame + TX_DATA_OFFSET, TX_FRAME_SIZE - TX_DATA_OFFSET};
+}
+
+void
+PacketRing::commitTxSlot(size_t frameLen) noexcept
+{
+  BOOST_ASSERT(frameLen <= TX_FRAME_SIZE - TX_DATA_OFFSET);
+
+  auto* hdr = reinterpret_cast<tpacket3_hdr*>(getTxFrame(m_txFrameIndex));
+  hdr->tp_next_offset = 0;
+  hdr->tp_len = static_cast<uint32_t>(frameLen);
+  hdr->tp_snaplen = static_cast<uint32_t>(frameLen);
+  __atomic_store_n(&hdr->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+
+  m_txFrameIndex = (m_txFrameIndex + 1) % TX_FRAME_COUNT;
+  ++m_nTxQueued;
+}
+
+bool
+PacketRing::flush(bool shouldWait) noexcept
+{
+  if (m_nTxQueued == 0)
+    return true;
+
+  // with a TX ring, a zero-length send transmits every frame marked TP_STATUS_SEND_REQUEST;
+  // without MSG_DONTWAIT, it returns only after the kernel has taken all of them
+  if (::sendto(m_fd, nullptr, 0, shouldWait ? 0 : MSG_DONTWAIT, nullptr, 0) >= 0) {
+    m_nTxQueued = 0;
+    return true;
+  }
+  // the frames that were not taken stay queued, and are taken by the next flush
+  return errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS;
+}
+
+uint8_t*
+PacketRing::getRxBlock(size_t index) const noexcept
+{
+  return m_map + index * RX_BLOCK_SIZE;
+}
+
+uint8_t*
+PacketRing::getTxFrame(size_t index) const noexcept
+{
+  // frames never straddle a block boundary, and TX_BLOCK_SIZE is a multiple of TX_FRAME_SIZE
+  return m_map + size_t{RX_BLOCK_SIZE} * RX_BLOCK_COUNT + index * TX_FRAME_SIZE;
+}
+
+} // namespace nfd::face
+
+#endif // defined(__linux__)
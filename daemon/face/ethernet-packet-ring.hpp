@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+#define NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
+
+#include "core/common.hpp"
+
+#if defined(__linux__)
+
+namespace nfd::face {
+
+/**
+ * @brief Helper class for AF_PACKET sockets with memory-mapped TPACKET_V3 rings.
+ *
+ * Received frames are read directly from the RX ring, one block of frames per wakeup.
+ * Outgoing frames are copied into the TX ring and handed to the kernel in batches,
+ * with a single system call per flush().
+ */
+class PacketRing : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Open a packet socket bound to an interface and map its RX and TX rings.
+   * @param interfaceIndex Index of the network interface
+   * @param ethertype EtherType of the frames to receive, in host byte order
+   * @throw Error on any error
+   * @sa packet(7)
+   */
+  PacketRing(int interfaceIndex, uint16_t ethertype);
+
+  ~PacketRing() noexcept;
+
+  /**
+   * @brief Unmap the rings and close the socket.
+   */
+  void
+  close() noexcept;
+
+  /**
+   * @brief Obtain a file descriptor that can be used in calls such as select(2) and poll(2).
+   * @return A duplicate of the socket descriptor. It is the caller's responsibility to close the fd.
+   * @throw Error on any error
+   */
+  int
+  getFd() const;
+
+  /**
+   * @brief Get the number of frames dropped because the RX ring was full.
+   * @throw Error on any error
+   */
+  size_t
+  getNDropped();
+
+  /**
+   * @brief Install a BPF filter on the socket.
+   *
+   * No frames are received until the first filter is installed, so that the RX ring
+   * never contains frames that the filter would have rejected.
+   *
+   * @param filter Null-terminated string containing the BPF program source.
+   * @throw Error on any error
+   * @sa pcap-filter(7)
+   */
+  void
+  setPacketFilter(const char* filter);
+
+  /**
+   * @brief Read the next frame from the RX ring.
+   * @return Same as PcapHelper::readNextPacket().
+   * @warning The returned span is valid only until the next call to this function.
+   */
+  std::tuple<span<const uint8_t>, std::string>
+  readNextPacket() noexcept;
+
+  /**
+   * @brief Get the next free slot in the TX ring.
+   * @return A writable view of the slot, or an empty span if the TX ring is full.
+   */
+  span<uint8_t>
+  getTxSlot() const noexcept;
+
+  /**
+   * @brief Queue the frame written into the slot returned by getTxSlot() for transmission.
+   * @param frameLen Length of the frame, including the Ethernet header
+   */
+  void
+  commitTxSlot(size_t frameLen) noexcept;
+
+  /**
+   * @brief Ask the kernel to transmit all queued frames.
+   *
+   * If the kernel cannot take the frames right now, they stay queued, and
+   * hasQueuedFrames() returns true until a later flush succeeds.
+   *
+   * @param shouldWait Block until the kernel has taken every queued frame.
+   * @return Whether the request succeeded or can be retried; on failure, errno is set.
+   */
+  bool
+  flush(bool shouldWait = false) noexcept;
+
+  /**
+   * @brief Returns whether frames have been committed but not yet handed to the kernel.
+   */
+  bool
+  hasQueuedFrames() const noexcept
+  {
+    return m_nTxQueued > 0;
+  }
+
+private:
+  uint8_t*
+  getRxBlock(size_t index) const noexcept;
+
+  uint8_t*
+  getTxFrame(size_t index) const noexcept;
+
+private:
+  const int m_interfaceIndex;
+  const uint16_t m_ethertype;
+  int m_fd = -1;
+  bool m_isBound = false;
+  uint8_t* m_map = nullptr;
+  size_t m_mapSize = 0;
+
+  // RX ring state
+  size_t m_rxBlockIndex = 0;
+  uint8_t* m_rxBlock = nullptr; ///< block being read, owned by userspace until released
+  uint8_t* m_rxFrame = nullptr; ///< next frame in m_rxBlock
+  size_t m_nRxRemaining = 0;    ///< number of frames left in m_rxBlock
+
+  // TX ring state
+  size_t m_txFrameIndex = 0;
+  size_t m_nTxQueued = 0;
+
+  size_t m_nDropped = 0;
+};
+
+} // namespace nfd::face
+
+#endif // defined(__linux__)
+
+#endif // NFD_DAEMON_FACE_ETHERNET_PACKET_RING_HPP
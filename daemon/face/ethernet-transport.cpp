@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -29,7 +29,10 @@
 
 #include <pcap/pcap.h>
 
+#include <algorithm>
 #include <array>
+#include <cerrno>    // for errno
+#include <cstring>   // for memcpy(), memset(), strerror()
 
 #include <boost/asio/defer.hpp>
 #include <boost/endian/conversion.hpp>
@@ -38,20 +41,49 @@ namespace nfd::face {
 
 NFD_LOG_INIT(EthernetTransport);
 
+std::ostream&
+operator<<(std::ostream& os, EthernetBackend backend)
+{
+  switch (backend) {
+  case EthernetBackend::PCAP:
+    return os << "pcap";
+  case EthernetBackend::TPACKET_V3:
+    return os << "tpacket_v3";
+  default:
+    return os << "none";
+  }
+}
+
 EthernetTransport::EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                                     const ethernet::Address& remoteEndpoint)
+                                     const ethernet::Address& remoteEndpoint,
+                                     EthernetBackend backend)
   : m_socket(getGlobalIoService())
   , m_pcap(localEndpoint.getName())
   , m_srcAddress(localEndpoint.getEthernetAddress())
   , m_destAddress(remoteEndpoint)
   , m_interfaceName(localEndpoint.getName())
 {
-  try {
-    m_pcap.activate(DLT_EN10MB);
-    m_socket.assign(m_pcap.getFd());
+  if (backend == EthernetBackend::TPACKET_V3) {
+#if defined(__linux__)
+    try {
+      m_ring = make_unique<PacketRing>(localEndpoint.getIndex(), ethernet::ETHERTYPE_NDN);
+      m_socket.assign(m_ring->getFd());
+    }
+    catch (const PacketRing::Error& e) {
+      NDN_THROW_NESTED(Error(e.what()));
+    }
+#else
+    NDN_THROW(Error("The tpacket_v3 backend is not supported on this platform"));
+#endif
   }
-  catch (const PcapHelper::Error& e) {
-    NDN_THROW_NESTED(Error(e.what()));
+  else {
+    try {
+      m_pcap.activate(DLT_EN10MB);
+      m_socket.assign(m_pcap.getFd());
+    }
+    catch (const PcapHelper::Error& e) {
+      NDN_THROW_NESTED(Error(e.what()));
+    }
   }
 
   // Set initial transport state based upon the state of the underlying NetworkInterface
@@ -75,6 +107,17 @@ EthernetTransport::doClose()
 {
   NFD_LOG_FACE_TRACE(__func__);
 
+#if defined(__linux__)
+  if (m_ring) {
+    // hand the frames committed in this turn to the kernel before the ring is unmapped
+    m_flushRetryEvent.cancel();
+    m_hasPendingFlush = false;
+    if (!m_ring->flush(true)) {
+      NFD_LOG_FACE_WARN("Failed to flush TX ring on close: " << std::strerror(errno));
+    }
+  }
+#endif
+
   if (m_socket.is_open()) {
     // Cancel all outstanding operations and close the socket.
     // Use the non-throwing variants and ignore errors, if any.
@@ -83,6 +126,11 @@ EthernetTransport::doClose()
     m_socket.close(error);
   }
   m_pcap.close();
+#if defined(__linux__)
+  if (m_ring) {
+    m_ring->close();
+  }
+#endif
 
   // Ensure that the Transport stays alive at least
   // until all pending handlers are dispatched
@@ -91,6 +139,18 @@ EthernetTransport::doClose()
   });
 }
 
+void
+EthernetTransport::setPacketFilter(const char* filter)
+{
+#if defined(__linux__)
+  if (m_ring) {
+    m_ring->setPacketFilter(filter);
+    return;
+  }
+#endif
+  m_pcap.setPacketFilter(filter);
+}
+
 void
 EthernetTransport::handleNetifStateChange(ndn::net::InterfaceState netifState)
 {
@@ -116,6 +176,13 @@ EthernetTransport::doSend(const Block& packet)
 void
 EthernetTransport::sendPacket(const ndn::Block& block)
 {
+#if defined(__linux__)
+  if (m_ring) {
+    enqueueToRing(block);
+    return;
+  }
+#endif
+
   ndn::EncodingBuffer buffer(block);
 
   // pad with zeroes if the payload is too short
@@ -142,6 +209,65 @@ EthernetTransport::sendPacket(const ndn::Block& block)
     NFD_LOG_FACE_TRACE("Successfully sent: " << block.size() << " bytes");
 }
 
+#if defined(__linux__)
+void
+EthernetTransport::enqueueToRing(const ndn::Block& block)
+{
+  auto slot = m_ring->getTxSlot();
+  if (slot.empty()) {
+    // the kernel has not yet released enough slots, push out what is queued and retry once
+    flushTxRing();
+    if (!m_socket.is_open()) {
+      return;
+    }
+    slot = m_ring->getTxSlot();
+    if (slot.empty()) {
+      NFD_LOG_FACE_DEBUG("TX ring is full, dropping packet of " << block.size() << " bytes");
+      ++nOutDropped;
+      return;
+    }
+  }
+
+  // build the frame in place: ethernet header, payload, and zero padding if the payload is too short
+  size_t payloadLen = std::max(block.size(), ethernet::MIN_DATA_LEN);
+  BOOST_ASSERT(ethernet::HDR_LEN + payloadLen <= slot.size());
+  constexpr uint16_t ethertype = boost::endian::native_to_big(ethernet::ETHERTYPE_NDN);
+  uint8_t* pos = slot.data();
+  std::memcpy(pos, m_destAddress.data(), ethernet::ADDR_LEN);
+  std::memcpy(pos + ethernet::ADDR_LEN, m_srcAddress.data(), ethernet::ADDR_LEN);
+  std::memcpy(pos + 2 * ethernet::ADDR_LEN, &ethertype, ethernet::TYPE_LEN);
+  pos += ethernet::HDR_LEN;
+  std::memcpy(pos, block.data(), block.size());
+  std::memset(pos + block.size(), 0, payloadLen - block.size());
+  m_ring->commitTxSlot(ethernet::HDR_LEN + payloadLen);
+
+  if (!m_hasPendingFlush) {
+    m_hasPendingFlush = true;
+    // doClose() flushes whatever is still queued when the face is closed
+    boost::asio::defer(getGlobalIoService(), [this] { flushTxRing(); });
+  }
+}
+
+void
+EthernetTransport::flushTxRing()
+{
+  m_hasPendingFlush = false;
+  if (!m_ring->flush()) {
+    handleError("Send operation failed: "s + std::strerror(errno));
+    return;
+  }
+
+  if (m_ring->hasQueuedFrames() && !m_flushRetryEvent) {
+    // the kernel could not take every frame, try again once it has made some progress
+    m_flushRetryEvent = getScheduler().schedule(FLUSH_RETRY_INTERVAL, [this] {
+      if (m_socket.is_open()) {
+        flushTxRing();
+      }
+    });
+  }
+}
+#endif // defined(__linux__)
+
 void
 EthernetTransport::asyncRead()
 {
@@ -164,25 +290,39 @@ EthernetTransport::handleRead(const boost::system::error_code& error)
     return;
   }
 
-  auto [pkt, readErr] = m_pcap.readNextPacket();
-  if (pkt.empty()) {
-    NFD_LOG_FACE_DEBUG("Read error: " << readErr);
+#if defined(__linux__)
+  if (m_ring) {
+    // consume every frame that is ready, the kernel hands them over one block at a time
+    while (true) {
+      auto [pkt, readErr] = m_ring->readNextPacket();
+      if (pkt.empty()) {
+        break;
+      }
+      handleFrame(pkt);
+      if (!m_socket.is_open()) {
+        // the transport was closed while processing the frame
+        return;
+      }
+    }
   }
-  else {
-    auto [eh, frameErr] = ethernet::checkFrameHeader(pkt, m_srcAddress,
-                                                     m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
-    if (eh == nullptr) {
-      NFD_LOG_FACE_WARN(frameErr);
+  else
+#endif
+  {
+    auto [pkt, readErr] = m_pcap.readNextPacket();
+    if (pkt.empty()) {
+      NFD_LOG_FACE_DEBUG("Read error: " << readErr);
     }
     else {
-      ethernet::Address sender(eh->ether_shost);
-      pkt = pkt.subspan(ethernet::HDR_LEN);
-      receivePayload(pkt, sender);
+      handleFrame(pkt);
     }
   }
 
 #ifndef NDEBUG
+#if defined(__linux__)
+  size_t nDropped = m_ring ? m_ring->getNDropped() : m_pcap.getNDropped();
+#else
   size_t nDropped = m_pcap.getNDropped();
+#endif
   if (nDropped - m_nDropped > 0)
     NFD_LOG_FACE_DEBUG("Detected " << nDropped - m_nDropped << " dropped frame(s)");
   m_nDropped = nDropped;
@@ -191,6 +331,20 @@ EthernetTransport::handleRead(const boost::system::error_code& error)
   asyncRead();
 }
 
+void
+EthernetTransport::handleFrame(span<const uint8_t> frame)
+{
+  auto [eh, frameErr] = ethernet::checkFrameHeader(frame, m_srcAddress,
+                                                   m_destAddress.isMulticast() ? m_destAddress : m_srcAddress);
+  if (eh == nullptr) {
+    NFD_LOG_FACE_WARN(frameErr);
+    return;
+  }
+
+  ethernet::Address sender(eh->ether_shost);
+  receivePayload(frame.subspan(ethernet::HDR_LEN), sender);
+}
+
 void
 EthernetTransport::receivePayload(span<const uint8_t> payload, const ethernet::Address& sender)
 {
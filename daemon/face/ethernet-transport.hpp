@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,15 +26,28 @@
 #ifndef NFD_DAEMON_FACE_ETHERNET_TRANSPORT_HPP
 #define NFD_DAEMON_FACE_ETHERNET_TRANSPORT_HPP
 
+#include "ethernet-packet-ring.hpp"
 #include "ethernet-protocol.hpp"
 #include "pcap-helper.hpp"
 #include "transport.hpp"
 
 #include <boost/asio/posix/stream_descriptor.hpp>
 #include <ndn-cxx/net/network-interface.hpp>
+#include <ndn-cxx/util/scheduler.hpp>
 
 namespace nfd::face {
 
+/**
+ * @brief Mechanism used by an EthernetTransport to exchange frames with the kernel.
+ */
+enum class EthernetBackend {
+  PCAP,       ///< libpcap, one system call per frame
+  TPACKET_V3, ///< memory-mapped TPACKET_V3 rings with batched receive and send (Linux only)
+};
+
+std::ostream&
+operator<<(std::ostream& os, EthernetBackend backend);
+
 /**
  * @brief Base class for Ethernet-based Transports.
  */
@@ -57,11 +70,19 @@ public:
 
 protected:
   EthernetTransport(const ndn::net::NetworkInterface& localEndpoint,
-                    const ethernet::Address& remoteEndpoint);
+                    const ethernet::Address& remoteEndpoint,
+                    EthernetBackend backend);
 
   void
   doClose() final;
 
+  /**
+   * @brief Installs a BPF filter on the receiving socket of the selected backend.
+   * @param filter Null-terminated string containing the BPF program source.
+   */
+  void
+  setPacketFilter(const char* filter);
+
   bool
   hasRecentlyReceived() const
   {
@@ -87,18 +108,44 @@ private:
   void
   sendPacket(const ndn::Block& block);
 
+#if defined(__linux__)
+  /**
+   * @brief Copies the frame carrying @p block into the TX ring.
+   *
+   * Frames queued during one turn of the event loop are handed to the kernel together
+   * afterwards, see flushTxRing().
+   */
+  void
+  enqueueToRing(const ndn::Block& block);
+
+  /**
+   * @brief Hands the queued frames to the kernel.
+   *
+   * If the kernel cannot take all of them, another attempt is scheduled after
+   * FLUSH_RETRY_INTERVAL.
+   */
+  void
+  flushTxRing();
+#endif
+
   void
   asyncRead();
 
   void
   handleRead(const boost::system::error_code& error);
 
+  void
+  handleFrame(span<const uint8_t> frame);
+
   void
   handleError(const std::string& errorMessage);
 
 protected:
   boost::asio::posix::stream_descriptor m_socket;
   PcapHelper m_pcap;
+#if defined(__linux__)
+  unique_ptr<PacketRing> m_ring; ///< set only if the TPACKET_V3 backend is selected
+#endif
   ethernet::Address m_srcAddress;
   ethernet::Address m_destAddress;
   std::string m_interfaceName;
@@ -107,8 +154,13 @@ private:
   signal::ScopedConnection m_netifStateChangedConn;
   signal::ScopedConnection m_netifMtuChangedConn;
   bool m_hasRecentlyReceived = false;
+#if defined(__linux__)
+  bool m_hasPendingFlush = false;
+  ndn::scheduler::ScopedEventId m_flushRetryEvent;
+  static constexpr time::milliseconds FLUSH_RETRY_INTERVAL = 1_ms;
+#endif
 #ifndef NDEBUG
-  /// Number of frames dropped by the kernel, as reported by libpcap
+  /// Number of frames dropped by the kernel, as reported by libpcap or the packet ring
   size_t m_nDropped = 0;
 #endif
 };
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -40,6 +40,7 @@ FaceCounters::FaceCounters(const LinkService::Counters& linkServiceCounters,
   , nOutPackets(transportCounters.nOutPackets)
   , nInBytes(transportCounters.nInBytes)
   , nOutBytes(transportCounters.nOutBytes)
+  , nOutDropped(transportCounters.nOutDropped)
   , m_linkServiceCounters(linkServiceCounters)
   , m_transportCounters(transportCounters)
 {
@@ -49,6 +50,7 @@ Face::Face(unique_ptr<LinkService> service, unique_ptr<Transport> transport)
   : afterReceiveInterest(service->afterReceiveInterest)
   , afterReceiveData(service->afterReceiveData)
   , afterReceiveNack(service->afterReceiveNack)
+  , afterReceiveBatch(service->afterReceiveBatch)
   , onDroppedInterest(service->onDroppedInterest)
   , afterStateChange(transport->afterStateChange)
   , m_service(std::move(service))
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -91,6 +91,7 @@ public:
   const PacketCounter& nOutPackets; ///< \copydoc Transport::Counters::nOutPackets
   const ByteCounter& nInBytes;      ///< \copydoc Transport::Counters::nInBytes
   const ByteCounter& nOutBytes;     ///< \copydoc Transport::Counters::nOutBytes
+  const PacketCounter& nOutDropped; ///< \copydoc Transport::Counters::nOutDropped
 
   /// Count of incoming Interests dropped due to HopLimit == 0.
   PacketCounter nInHopLimitZero;
@@ -184,6 +185,9 @@ public: // upper interface connected to forwarding
   /// \copydoc LinkService::afterReceiveNack
   signal::Signal<LinkService, lp::Nack, EndpointId>& afterReceiveNack;
 
+  /// \copydoc LinkService::afterReceiveBatch
+  signal::Signal<LinkService, span<const ReceivedPacket>>& afterReceiveBatch;
+
   /// \copydoc LinkService::onDroppedInterest
   signal::Signal<LinkService, Interest>& onDroppedInterest;
 
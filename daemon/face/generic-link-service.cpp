@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -288,6 +288,14 @@ void
 GenericLinkService::doReceivePacket(const Block& packet, const EndpointId& endpoint)
 {
   try {
+    if (!m_options.reliabilityOptions.isEnabled &&
+        (packet.type() == tlv::Interest || packet.type() == tlv::Data)) {
+      // A bare network packet carries no link-layer fields. Decoding it directly avoids
+      // copying it into an LpPacket, so that it keeps referencing the receive buffer.
+      this->decodeNetPacket(packet, lp::Packet{}, endpoint);
+      return;
+    }
+
     lp::Packet pkt(packet);
 
     if (m_options.reliabilityOptions.isEnabled) {
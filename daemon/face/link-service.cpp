@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -75,6 +75,50 @@ LinkService::sendNack(const ndn::lp::Nack& nack)
   doSendNack(nack);
 }
 
+void
+LinkService::receivePackets(span<const Block> packets, const EndpointId& endpoint)
+{
+  if (afterReceiveBatch.isEmpty()) {
+    for (const Block& packet : packets) {
+      doReceivePacket(packet, endpoint);
+    }
+    return;
+  }
+
+  BOOST_ASSERT(!m_isCollectingBatch);
+  m_isCollectingBatch = true;
+  for (const Block& packet : packets) {
+    doReceivePacket(packet, endpoint);
+  }
+  m_isCollectingBatch = false;
+
+  if (m_batch.empty())
+    return;
+
+  // a subscriber may cause this link service to receive another burst, e.g., through a loopback
+  std::vector<ReceivedPacket> batch;
+  batch.swap(m_batch);
+  afterReceiveBatch(batch);
+  batch.clear();
+  if (m_batch.empty()) {
+    // keep the allocated capacity for the next burst
+    m_batch.swap(batch);
+  }
+}
+
+// The network-layer packets passed by subclasses are normally created with make_shared,
+// see GenericLinkService; otherwise, a copy is kept for the batch.
+template<typename Packet>
+static shared_ptr<const Packet>
+sharePacket(const Packet& packet)
+{
+  shared_ptr<const Packet> ptr = packet.weak_from_this().lock();
+  if (ptr == nullptr) {
+    ptr = make_shared<Packet>(packet);
+  }
+  return ptr;
+}
+
 void
 LinkService::receiveInterest(const Interest& interest, const EndpointId& endpoint)
 {
@@ -82,6 +126,10 @@ LinkService::receiveInterest(const Interest& interest, const EndpointId& endpoin
 
   ++this->nInInterests;
 
+  if (m_isCollectingBatch) {
+    m_batch.push_back({sharePacket(interest), endpoint});
+    return;
+  }
   afterReceiveInterest(interest, endpoint);
 }
 
@@ -92,6 +140,10 @@ LinkService::receiveData(const Data& data, const EndpointId& endpoint)
 
   ++this->nInData;
 
+  if (m_isCollectingBatch) {
+    m_batch.push_back({sharePacket(data), endpoint});
+    return;
+  }
   afterReceiveData(data, endpoint);
 }
 
@@ -102,6 +154,10 @@ LinkService::receiveNack(const ndn::lp::Nack& nack, const EndpointId& endpoint)
 
   ++this->nInNacks;
 
+  if (m_isCollectingBatch) {
+    m_batch.push_back({make_shared<lp::Nack>(nack), endpoint});
+    return;
+  }
   afterReceiveNack(nack, endpoint);
 }
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -56,6 +56,16 @@ public:
   PacketCounter nOutNacks;
 };
 
+/**
+ * \brief A network-layer packet decoded from a burst of lower-layer packets.
+ * \sa LinkService::afterReceiveBatch
+ */
+struct ReceivedPacket
+{
+  std::variant<shared_ptr<const Interest>, shared_ptr<const Data>, shared_ptr<const lp::Nack>> packet;
+  EndpointId endpoint;
+};
+
 /**
  * \brief The upper half of a Face.
  * \sa Face, Transport
@@ -155,6 +165,15 @@ public: // upper interface to be used by forwarding
    */
   signal::Signal<LinkService, lp::Nack, EndpointId> afterReceiveNack;
 
+  /**
+   * \brief Called with the network-layer packets decoded from a burst passed to receivePackets().
+   *
+   * While this signal has a connection, afterReceiveInterest, afterReceiveData, and
+   * afterReceiveNack are not emitted for packets decoded from a burst, so that a subscriber
+   * can process the whole burst in a single loop.
+   */
+  signal::Signal<LinkService, span<const ReceivedPacket>> afterReceiveBatch;
+
   /**
    * \brief Called when an Interest is dropped by the reliability system
    *        for exceeding the allowed number of retransmissions.
@@ -171,6 +190,13 @@ public: // lower interface to be invoked by Transport
     doReceivePacket(packet, endpoint);
   }
 
+  /**
+   * \brief Performs LinkService-specific operations to receive a burst of lower-layer packets.
+   * \sa afterReceiveBatch
+   */
+  void
+  receivePackets(span<const Block> packets, const EndpointId& endpoint);
+
 protected: // upper interface to be invoked in subclass (receive path termination)
   /**
    * \brief Delivers received Interest to forwarding.
@@ -230,6 +256,8 @@ private: // lower interface to be overridden in subclass
 private:
   Face* m_face = nullptr;
   Transport* m_transport = nullptr;
+  bool m_isCollectingBatch = false;
+  std::vector<ReceivedPacket> m_batch; ///< packets decoded from the current burst
 };
 
 std::ostream&
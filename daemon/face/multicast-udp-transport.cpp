@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -58,6 +58,7 @@ MulticastUdpTransport::MulticastUdpTransport(const ip::udp::endpoint& multicastG
   this->setPersistency(ndn::nfd::FACE_PERSISTENCY_PERMANENT);
   this->setLinkType(linkType);
   this->setMtu(udp::computeMtu(m_sendSocket.local_endpoint()));
+  this->setTxSocket(m_sendSocket, m_multicastGroup);
 
   boost::asio::socket_base::send_buffer_size sendBufferSizeOption;
   boost::system::error_code error;
@@ -73,31 +74,14 @@ MulticastUdpTransport::MulticastUdpTransport(const ip::udp::endpoint& multicastG
   NFD_LOG_FACE_DEBUG("Creating transport");
 }
 
-ssize_t
-MulticastUdpTransport::getSendQueueLength()
-{
-  ssize_t queueLength = getTxQueueLength(m_sendSocket.native_handle());
-  if (queueLength == QUEUE_ERROR) {
-    NFD_LOG_FACE_WARN("Failed to obtain send queue length from socket: " << std::strerror(errno));
-  }
-  return queueLength;
-}
-
-void
-MulticastUdpTransport::doSend(const Block& packet)
-{
-  NFD_LOG_FACE_TRACE(__func__);
-
-  m_sendSocket.async_send_to(boost::asio::buffer(packet), m_multicastGroup,
-                             // 'packet' is copied into the lambda to retain the underlying Buffer
-                             [this, packet] (auto&&... args) {
-                               this->handleSend(std::forward<decltype(args)>(args)...);
-                             });
-}
-
 void
 MulticastUdpTransport::doClose()
 {
+  if (getState() == TransportState::CLOSING) {
+    // send the queued packets before the sending socket is closed
+    flushSendQueue();
+  }
+
   if (m_sendSocket.is_open()) {
     NFD_LOG_FACE_TRACE("Closing sending socket");
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -59,9 +59,6 @@ public:
                         boost::asio::ip::udp::socket&& sendSocket,
                         ndn::nfd::LinkType linkType);
 
-  ssize_t
-  getSendQueueLength() final;
-
   /**
    * \brief Opens and configures the receive-side socket.
    */
@@ -81,9 +78,6 @@ public:
                bool enableLoopback = false);
 
 private:
-  void
-  doSend(const Block& packet) final;
-
   void
   doClose() final;
 
@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "receive-buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace nfd::face {
+
+ReceiveBuffer::ReceiveBuffer(size_t capacity)
+  : m_storage(make_shared<ndn::Buffer>(capacity))
+{
+}
+
+std::tuple<bool, Block>
+ReceiveBuffer::decode(size_t offset, size_t length) const
+{
+  BOOST_ASSERT(offset + length <= size());
+
+  auto [isOk, element] = Block::fromBuffer(m_storage, offset);
+  // the storage beyond 'length' contains stale bytes
+  if (!isOk || element.size() > length) {
+    return {false, Block{}};
+  }
+
+  if (element.size() * MAX_SHARED_RATIO < size()) {
+    return Block::fromBuffer(span<const uint8_t>(element.data(), element.size()));
+  }
+  return {true, element};
+}
+
+void
+ReceiveBuffer::prepare(size_t offset, size_t length)
+{
+  BOOST_ASSERT(offset + length <= size());
+
+  if (!isShared()) {
+    if (offset != 0 && length != 0) {
+      std::memmove(data(), data() + offset, length);
+    }
+    return;
+  }
+
+  auto released = std::find_if(m_retired.begin(), m_retired.end(),
+                               [] (const auto& storage) { return storage.use_count() == 1; });
+  shared_ptr<ndn::Buffer> next;
+  if (released != m_retired.end()) {
+    next = std::move(*released);
+    m_retired.erase(released);
+  }
+  else {
+    next = make_shared<ndn::Buffer>(size());
+  }
+
+  std::memcpy(next->data(), data() + offset, length);
+
+  if (m_retired.size() >= MAX_RETIRED) {
+    // the oldest storage is likely held for a long time, e.g., by a ContentStore entry
+    m_retired.erase(m_retired.begin());
+  }
+  m_retired.push_back(std::exchange(m_storage, std::move(next)));
+}
+
+} // namespace nfd::face
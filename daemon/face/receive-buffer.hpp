@@ -0,0 +1,108 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_RECEIVE_BUFFER_HPP
+#define NFD_DAEMON_FACE_RECEIVE_BUFFER_HPP
+
+#include "core/common.hpp"
+
+#include <ndn-cxx/encoding/buffer.hpp>
+
+#include <tuple>
+
+namespace nfd::face {
+
+/**
+ * \brief A buffer into which a transport receives packets, and from which it decodes them.
+ *
+ * The storage is a refcounted ndn::Buffer. A decoded packet that occupies at least
+ * 1/MAX_SHARED_RATIO of the storage references it directly instead of being copied, so that
+ * it can be cached in the ContentStore and sent on other faces without any copy. Smaller
+ * packets are copied, so that a retained packet never keeps alive more than MAX_SHARED_RATIO
+ * times its own size. Stream transports size their storage for two full-size packets, so
+ * that packets of at least a quarter of the maximum packet size are received without a copy.
+ *
+ * Before receiving into bytes that a decoded packet may reference, prepare() must be called
+ * to ensure that the storage is no longer referenced by any packet. Otherwise, the storage is
+ * replaced by one that has been released by all packets since, or by a new one. Bytes after
+ * the end of the last decoded packet can be written at any time.
+ */
+class ReceiveBuffer : noncopyable
+{
+public:
+  explicit
+  ReceiveBuffer(size_t capacity = ndn::MAX_NDN_PACKET_SIZE);
+
+  uint8_t*
+  data() noexcept
+  {
+    return m_storage->data();
+  }
+
+  size_t
+  size() const noexcept
+  {
+    return m_storage->size();
+  }
+
+  /**
+   * \brief Decodes a TLV element starting at \p offset, within the next \p length bytes.
+   * \return whether a complete and well-formed element was found, and the element
+   */
+  std::tuple<bool, Block>
+  decode(size_t offset, size_t length) const;
+
+  /**
+   * \brief Makes the storage writable, keeping \p length bytes from \p offset.
+   * \post The kept bytes are at the beginning of the storage, which is not referenced
+   *       by any decoded packet.
+   */
+  void
+  prepare(size_t offset = 0, size_t length = 0);
+
+  /**
+   * \brief Returns whether the storage is referenced by a decoded packet.
+   */
+  bool
+  isShared() const noexcept
+  {
+    return m_storage.use_count() > 1;
+  }
+
+public:
+  /// A decoded packet references the storage if the storage is at most this many times its size
+  static constexpr size_t MAX_SHARED_RATIO = 4;
+  /// Maximum number of storages waiting to be released by decoded packets
+  static constexpr size_t MAX_RETIRED = 4;
+
+private:
+  shared_ptr<ndn::Buffer> m_storage;
+  /// storages referenced by decoded packets, which can be reused once released
+  std::vector<shared_ptr<ndn::Buffer>> m_retired;
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_RECEIVE_BUFFER_HPP
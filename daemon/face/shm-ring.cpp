@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "shm-ring.hpp"
+
+#include <cstring>
+#include <new>
+
+namespace nfd::face {
+
+ShmRing::ShmRing(uint8_t* region, size_t capacity, bool shouldInitialize)
+  : m_header(reinterpret_cast<Header*>(region))
+  , m_data(region + HEADER_SIZE)
+  , m_capacity(capacity)
+{
+  BOOST_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+
+  if (shouldInitialize) {
+    new (m_header) Header{};
+    m_header->head.store(0, std::memory_order_relaxed);
+    m_header->tail.store(0, std::memory_order_relaxed);
+    m_header->isProducerWaiting.store(0, std::memory_order_release);
+  }
+  m_tail = m_header->tail.load(std::memory_order_acquire);
+}
+
+bool
+ShmRing::push(span<const uint8_t> packet) noexcept
+{
+  BOOST_ASSERT(packet.size() <= getMaxPacketSize());
+
+  uint64_t head = m_header->head.load(std::memory_order_relaxed);
+  uint64_t tail = m_header->tail.load(std::memory_order_acquire);
+  size_t offset = head & (m_capacity - 1);
+  size_t untilEnd = m_capacity - offset;
+  size_t recordSize = getRecordSize(packet.size());
+  // a record that does not fit before the end of the data area is preceded by a wrap marker
+  size_t needed = recordSize <= untilEnd ? recordSize : untilEnd + recordSize;
+  if (m_capacity - (head - tail) < needed) {
+    return false;
+  }
+
+  if (recordSize > untilEnd) {
+    uint32_t marker = WRAP_MARKER;
+    std::memcpy(m_data + offset, &marker, sizeof(marker));
+    head += untilEnd;
+    offset = 0;
+  }
+
+  uint32_t length = static_cast<uint32_t>(packet.size());
+  std::memcpy(m_data + offset, &length, sizeof(length));
+  std::memcpy(m_data + offset + RECORD_HEADER_SIZE, packet.data(), packet.size());
+  m_header->head.store(head + recordSize, std::memory_order_release);
+  return true;
+}
+
+span<const uint8_t>
+ShmRing::front() noexcept
+{
+  if (m_isCorrupted) {
+    return {};
+  }
+
+  // the producer is untrusted, every position and length is checked before it is used,
+  // so that nothing outside of the published part of the data area is ever read
+  uint64_t head = m_header->head.load(std::memory_order_acquire);
+  if (head - m_tail > m_capacity || (m_tail & 7) != 0) {
+    m_isCorrupted = true;
+    return {};
+  }
+
+  while (m_tail != head) {
+    size_t offset = m_tail & (m_capacity - 1);
+    size_t available = head - m_tail;
+    if (available < RECORD_HEADER_SIZE) {
+      m_isCorrupted = true;
+      return {};
+    }
+
+    uint32_t length;
+    std::memcpy(&length, m_data + offset, sizeof(length));
+    if (length == WRAP_MARKER) {
+      // a wrap marker is never written at the beginning of the data area
+      size_t untilEnd = m_capacity - offset;
+      if (offset == 0 || untilEnd > available) {
+        m_isCorrupted = true;
+        return {};
+      }
+      m_tail += untilEnd;
+      m_header->tail.store(m_tail, std::memory_order_release);
+      continue;
+    }
+
+    size_t recordSize = getRecordSize(length);
+    if (length > getMaxPacketSize() || recordSize > m_capacity - offset || recordSize > available) {
+      m_isCorrupted = true;
+      return {};
+    }
+    m_frontSize = recordSize;
+    return {m_data + offset + RECORD_HEADER_SIZE, length};
+  }
+  return {};
+}
+
+void
+ShmRing::pop() noexcept
+{
+  BOOST_ASSERT(m_frontSize > 0);
+  m_tail += m_frontSize;
+  m_frontSize = 0;
+  m_header->tail.store(m_tail, std::memory_order_release);
+}
+
+void
+ShmRing::setProducerWaiting() noexcept
+{
+  m_header->isProducerWaiting.store(1, std::memory_order_seq_cst);
+}
+
+bool
+ShmRing::clearProducerWaiting() noexcept
+{
+  return m_header->isProducerWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+} // namespace nfd::face
@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_SHM_RING_HPP
+#define NFD_DAEMON_FACE_SHM_RING_HPP
+
+#include "core/common.hpp"
+
+#include <atomic>
+
+namespace nfd::face {
+
+/**
+ * \brief A lock-free single-producer single-consumer ring of packets in shared memory.
+ *
+ * The ring occupies #HEADER_SIZE bytes of control data followed by a data area of
+ * `capacity` bytes, see getRegionSize(). It can be mapped into two processes, one of
+ * which only pushes and the other only pops. Each record is a 4-octet length in host
+ * byte order followed by the packet, padded to a multiple of 8 octets. A record never
+ * wraps around the end of the data area; a length of #WRAP_MARKER means that the next
+ * record starts at the beginning of the data area.
+ *
+ * The ring does not signal the other side by itself. When push() fails, the producer
+ * may call setProducerWaiting() and wait to be woken up by the consumer, which calls
+ * clearProducerWaiting() after popping records.
+ */
+class ShmRing : noncopyable
+{
+public:
+  /**
+   * \brief Returns the number of bytes needed for a ring with the given data capacity.
+   */
+  static constexpr size_t
+  getRegionSize(size_t capacity) noexcept
+  {
+    return HEADER_SIZE + capacity;
+  }
+
+  /**
+   * \brief Constructs a view of the ring located at \p region.
+   * \param region shared memory of getRegionSize(\p capacity) bytes, aligned to a page
+   * \param capacity size of the data area, must be a power of 2
+   * \param shouldInitialize whether to reset the control data; only the side that
+   *                         creates the shared memory may do so, before sharing it
+   */
+  ShmRing(uint8_t* region, size_t capacity, bool shouldInitialize);
+
+  /**
+   * \brief Returns the largest packet that can be pushed.
+   */
+  size_t
+  getMaxPacketSize() const noexcept
+  {
+    return m_capacity / 2 - RECORD_HEADER_SIZE;
+  }
+
+  /**
+   * \brief Appends a packet; must be called by the producer only.
+   * \retval false the ring does not have enough free space
+   * \pre packet.size() <= getMaxPacketSize()
+   */
+  bool
+  push(span<const uint8_t> packet) noexcept;
+
+  /**
+   * \brief Returns the oldest packet, or an empty span if the ring is empty or corrupted;
+   *        must be called by the consumer only.
+   * \note The returned span is valid until pop() is called.
+   * \sa isCorrupted()
+   */
+  span<const uint8_t>
+  front() noexcept;
+
+  /**
+   * \brief Returns whether front() found control data or a record that the producer cannot
+   *        have written.
+   *
+   * The producer is not trusted. Once the ring is corrupted, front() always returns an empty
+   * span and the consumer should stop using the ring.
+   */
+  bool
+  isCorrupted() const noexcept
+  {
+    return m_isCorrupted;
+  }
+
+  /**
+   * \brief Removes the packet returned by front(); must be called by the consumer only.
+   * \pre front() returned a non-empty span
+   */
+  void
+  pop() noexcept;
+
+  /**
+   * \brief Records that the producer waits for free space.
+   */
+  void
+  setProducerWaiting() noexcept;
+
+  /**
+   * \brief Clears the record set by setProducerWaiting().
+   * \return whether the producer was waiting and should be woken up
+   */
+  bool
+  clearProducerWaiting() noexcept;
+
+public:
+  /// Size of the control data at the beginning of the region
+  static constexpr size_t HEADER_SIZE = 4096;
+  /// Length of a record that marks the end of the usable data area
+  static constexpr uint32_t WRAP_MARKER = 0xFFFFFFFF;
+
+private:
+  static constexpr size_t RECORD_HEADER_SIZE = sizeof(uint32_t);
+
+  static constexpr size_t
+  getRecordSize(size_t packetSize) noexcept
+  {
+    return (RECORD_HEADER_SIZE + packetSize + 7) & ~size_t{7};
+  }
+
+  /**
+   * \brief Control data, each index on its own cache line to avoid false sharing.
+   */
+  struct Header
+  {
+    alignas(64) std::atomic<uint64_t> head; ///< total bytes written by the producer
+    alignas(64) std::atomic<uint64_t> tail; ///< total bytes released by the consumer
+    alignas(64) std::atomic<uint32_t> isProducerWaiting;
+  };
+  static_assert(sizeof(Header) <= HEADER_SIZE);
+  static_assert(std::atomic<uint64_t>::is_always_lock_free,
+                "ShmRing requires lock-free 64-bit atomics to work across processes");
+
+  Header* m_header;
+  uint8_t* m_data;
+  const size_t m_capacity;
+  uint64_t m_tail = 0; ///< consumer only: position of the record returned by front()
+  size_t m_frontSize = 0; ///< consumer only: size of the record returned by front()
+  bool m_isCorrupted = false; ///< consumer only
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_SHM_RING_HPP
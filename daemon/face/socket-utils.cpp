@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,6 +26,8 @@
 #include "socket-utils.hpp"
 #include "transport.hpp"
 
+#include <algorithm>
+
 #if defined(__linux__)
 #include <linux/sockios.h>
 #include <sys/ioctl.h>
@@ -52,4 +54,82 @@ getTxQueueLength(int fd)
   return queueLength;
 }
 
+size_t
+sendDatagrams(int fd, span<const Block> packets, const sockaddr* dest, socklen_t destLen)
+{
+  size_t nSent = 0;
+#if defined(__linux__)
+  constexpr size_t MAX_MSGS_PER_CALL = 64;
+  std::array<mmsghdr, MAX_MSGS_PER_CALL> msgs;
+  std::array<iovec, MAX_MSGS_PER_CALL> iovs;
+  while (nSent < packets.size()) {
+    size_t count = std::min(packets.size() - nSent, MAX_MSGS_PER_CALL);
+    for (size_t i = 0; i < count; ++i) {
+      const Block& packet = packets[nSent + i];
+      iovs[i].iov_base = const_cast<uint8_t*>(packet.data());
+      iovs[i].iov_len = packet.size();
+      msgs[i] = {};
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = const_cast<sockaddr*>(dest);
+      msgs[i].msg_hdr.msg_namelen = dest == nullptr ? 0 : destLen;
+    }
+
+    int n = ::sendmmsg(fd, msgs.data(), static_cast<unsigned int>(count), MSG_DONTWAIT);
+    if (n < 0) {
+      break;
+    }
+    // if fewer than count were sent, the next call reports the error
+    nSent += static_cast<size_t>(n);
+  }
+#else
+  for (; nSent < packets.size(); ++nSent) {
+    const Block& packet = packets[nSent];
+    if (::sendto(fd, packet.data(), packet.size(), MSG_DONTWAIT, dest, dest == nullptr ? 0 : destLen) < 0) {
+      break;
+    }
+  }
+#endif
+  return nSent;
+}
+
+size_t
+DatagramBatch::receive([[maybe_unused]] int fd, [[maybe_unused]] size_t maxCount)
+{
+  m_count = 0;
+#if defined(__linux__)
+  maxCount = std::min(maxCount, MAX_SIZE);
+  std::array<mmsghdr, MAX_SIZE> msgs{};
+  std::array<iovec, MAX_SIZE> iovs;
+  for (size_t i = 0; i < maxCount; ++i) {
+    m_buffers[i].prepare();
+    iovs[i].iov_base = m_buffers[i].data();
+    iovs[i].iov_len = m_buffers[i].size();
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+    msgs[i].msg_hdr.msg_name = &m_addrs[i];
+    msgs[i].msg_hdr.msg_namelen = sizeof(m_addrs[i]);
+  }
+
+  int n = ::recvmmsg(fd, msgs.data(), static_cast<unsigned int>(maxCount), MSG_DONTWAIT, nullptr);
+  if (n <= 0) {
+    return 0;
+  }
+
+  m_count = static_cast<size_t>(n);
+  for (size_t i = 0; i < m_count; ++i) {
+    m_payloadLengths[i] = msgs[i].msg_len;
+    m_addrLengths[i] = msgs[i].msg_hdr.msg_namelen;
+  }
+#endif
+  return m_count;
+}
+
+DatagramBatch&
+getDatagramBatch()
+{
+  static thread_local auto batch = make_unique<DatagramBatch>();
+  return *batch;
+}
+
 } // namespace nfd::face
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,7 +26,12 @@
 #ifndef NFD_DAEMON_FACE_SOCKET_UTILS_HPP
 #define NFD_DAEMON_FACE_SOCKET_UTILS_HPP
 
-#include "core/common.hpp"
+#include "receive-buffer.hpp"
+
+#include <array>
+#include <cstring>
+
+#include <sys/socket.h>
 
 namespace nfd::face {
 
@@ -41,6 +46,88 @@ namespace nfd::face {
 ssize_t
 getTxQueueLength(int fd);
 
+/** \brief Sends datagrams on a socket with as few system calls as possible, without blocking.
+ *  \param fd file descriptor of a datagram socket
+ *  \param packets the datagrams to send
+ *  \param dest destination address, or nullptr if the socket is connected
+ *  \param destLen size of \p dest
+ *  \return number of datagrams sent; if it is less than packets.size(), errno indicates why
+ *          the next datagram could not be sent
+ *
+ *  On Linux, sendmmsg() is used. On other platforms, sendto() is called for each datagram.
+ */
+size_t
+sendDatagrams(int fd, span<const Block> packets, const sockaddr* dest, socklen_t destLen);
+
+/** \brief Buffers for receiving a batch of datagrams with a single system call.
+ *
+ *  Received payloads and sender addresses remain valid until the next call to receive().
+ *  Because of its size, a DatagramBatch should not be allocated per socket;
+ *  use getDatagramBatch() instead.
+ */
+class DatagramBatch : noncopyable
+{
+public:
+  static constexpr size_t MAX_SIZE = 32;
+
+  /** \brief Receives datagrams that are already queued on a socket, without blocking.
+   *  \param fd file descriptor of a datagram socket
+   *  \param maxCount maximum number of datagrams to receive, capped at MAX_SIZE
+   *  \return number of received datagrams; zero if no datagram is queued, if an error occurred,
+   *          or if batched receive is unsupported on the current platform
+   *
+   *  On Linux, recvmmsg() is used. Errors are not reported, because the caller is expected to
+   *  have an asynchronous receive operation pending on the same socket, which will fail.
+   */
+  size_t
+  receive(int fd, size_t maxCount = MAX_SIZE);
+
+  /** \brief Returns the buffer holding the i-th datagram.
+   *
+   *  Packets decoded from this buffer may reference it, see ReceiveBuffer.
+   */
+  const ReceiveBuffer&
+  getBuffer(size_t i) const
+  {
+    BOOST_ASSERT(i < m_count);
+    return m_buffers[i];
+  }
+
+  size_t
+  getPayloadLength(size_t i) const
+  {
+    BOOST_ASSERT(i < m_count);
+    return m_payloadLengths[i];
+  }
+
+  /** \brief Copies the sender address of the i-th datagram into a Boost.Asio \p endpoint.
+   */
+  template<typename Endpoint>
+  void
+  getSender(size_t i, Endpoint& endpoint) const
+  {
+    BOOST_ASSERT(i < m_count);
+    BOOST_ASSERT(m_addrLengths[i] <= endpoint.capacity());
+    std::memcpy(endpoint.data(), &m_addrs[i], m_addrLengths[i]);
+    endpoint.resize(m_addrLengths[i]);
+  }
+
+private:
+  std::array<ReceiveBuffer, MAX_SIZE> m_buffers;
+  std::array<size_t, MAX_SIZE> m_payloadLengths;
+  std::array<sockaddr_storage, MAX_SIZE> m_addrs;
+  std::array<socklen_t, MAX_SIZE> m_addrLengths;
+  size_t m_count = 0;
+};
+
+/** \brief Returns the DatagramBatch of the current thread.
+ *
+ *  Datagrams are processed synchronously after being received, so that a single
+ *  DatagramBatch can be shared among all sockets of a thread.
+ */
+DatagramBatch&
+getDatagramBatch();
+
 } // namespace nfd::face
 
 #endif // NFD_DAEMON_FACE_SOCKET_UTILS_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -30,11 +30,9 @@
 #include "socket-utils.hpp"
 #include "common/global.hpp"
 
-#include <array>
-#include <queue>
+#include <deque>
 
 #include <boost/asio/defer.hpp>
-#include <boost/asio/write.hpp>
 
 namespace nfd::face {
 
@@ -70,6 +68,13 @@ protected:
   void
   doSend(const Block& packet) override;
 
+  /**
+   * \brief Writes as many queued packets as allowed with a single gather write.
+   *
+   * The write starts at the first byte of the front packet that has not been sent yet,
+   * and covers at most #MAX_GATHER_BUFFERS packets and #MAX_GATHER_BYTES bytes, unless
+   * the front packet alone is larger.
+   */
   void
   sendFromQueue();
 
@@ -84,6 +89,15 @@ protected:
   handleReceive(const boost::system::error_code& error,
                 size_t nBytesReceived);
 
+  /**
+   * \brief Delivers the packets decoded from one read to the upper layer.
+   */
+  virtual void
+  deliverPackets(span<const Block> packets)
+  {
+    this->receive(packets);
+  }
+
   void
   processErrorCode(const boost::system::error_code& error);
 
@@ -104,11 +118,23 @@ protected:
 
   NFD_LOG_MEMBER_DECL();
 
+  /// Maximum number of packets passed to a single gather write
+  static constexpr size_t MAX_GATHER_BUFFERS = 64;
+  /// Byte budget of a single gather write; the first packet is always included
+  static constexpr size_t MAX_GATHER_BYTES = 65536;
+  /// Capacity of the receive buffer, which holds two full-size packets so that one read can
+  /// deliver a burst of packets, while a received packet that references the buffer keeps
+  /// alive at most ReceiveBuffer::MAX_SHARED_RATIO times its own size
+  static constexpr size_t RECEIVE_BUFFER_SIZE = 2 * ndn::MAX_NDN_PACKET_SIZE;
+
 private:
-  size_t m_sendQueueBytes = 0;
-  std::queue<Block> m_sendQueue;
-  size_t m_receiveBufferSize = 0;
-  std::array<uint8_t, ndn::MAX_NDN_PACKET_SIZE> m_receiveBuffer;
+  size_t m_sendQueueBytes = 0; ///< number of queued bytes not yet written to the socket
+  std::deque<Block> m_sendQueue;
+  size_t m_sendOffset = 0; ///< number of bytes of the front packet already written
+  size_t m_receiveBufferStart = 0; ///< offset of the first unparsed byte in m_receiveBuffer
+  size_t m_receiveBufferSize = 0; ///< offset of the end of the received bytes in m_receiveBuffer
+  ReceiveBuffer m_receiveBuffer{RECEIVE_BUFFER_SIZE};
+  std::vector<Block> m_receivedPackets; ///< packets decoded from one read, reused across reads
 };
 
 
@@ -191,19 +217,40 @@ StreamTransport<T>::doSend(const Block& packet)
     return;
 
   bool wasQueueEmpty = m_sendQueue.empty();
-  m_sendQueue.push(packet);
+  m_sendQueue.push_back(packet);
   m_sendQueueBytes += packet.size();
 
-  if (wasQueueEmpty)
-    sendFromQueue();
+  if (wasQueueEmpty) {
+    // packets queued during the current turn of the event loop are written together afterwards;
+    // this runs before deferredClose() because handlers are dispatched in order
+    boost::asio::defer(getGlobalIoService(), [this] { sendFromQueue(); });
+  }
 }
 
 template<class T>
 void
 StreamTransport<T>::sendFromQueue()
 {
-  boost::asio::async_write(m_socket, boost::asio::buffer(m_sendQueue.front()),
-                           [this] (auto&&... args) { this->handleSend(std::forward<decltype(args)>(args)...); });
+  if (m_sendQueue.empty())
+    return;
+
+  std::vector<boost::asio::const_buffer> buffers;
+  buffers.reserve(std::min(m_sendQueue.size(), MAX_GATHER_BUFFERS));
+  size_t nBytes = 0;
+  size_t offset = m_sendOffset;
+  for (const Block& packet : m_sendQueue) {
+    size_t len = packet.size() - offset;
+    if (buffers.size() == MAX_GATHER_BUFFERS ||
+        (!buffers.empty() && nBytes + len > MAX_GATHER_BYTES))
+      break;
+    buffers.emplace_back(packet.data() + offset, len);
+    nBytes += len;
+    offset = 0;
+  }
+
+  // the socket may accept only part of the data, see handleSend()
+  m_socket.async_write_some(buffers,
+                            [this] (auto&&... args) { this->handleSend(std::forward<decltype(args)>(args)...); });
 }
 
 template<class T>
@@ -217,9 +264,17 @@ StreamTransport<T>::handleSend(const boost::system::error_code& error,
   NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
 
   BOOST_ASSERT(!m_sendQueue.empty());
-  BOOST_ASSERT(m_sendQueue.front().size() == nBytesSent);
+  BOOST_ASSERT(nBytesSent <= m_sendQueueBytes);
   m_sendQueueBytes -= nBytesSent;
-  m_sendQueue.pop();
+
+  // pop the packets that were written entirely and remember how much of the next one was written
+  size_t nBytes = m_sendOffset + nBytesSent;
+  while (!m_sendQueue.empty() && m_sendQueue.front().size() <= nBytes) {
+    nBytes -= m_sendQueue.front().size();
+    m_sendQueue.pop_front();
+  }
+  m_sendOffset = nBytes;
+  BOOST_ASSERT(m_sendQueue.empty() ? m_sendOffset == 0 : m_sendOffset < m_sendQueue.front().size());
 
   if (!m_sendQueue.empty())
     sendFromQueue();
@@ -247,32 +302,43 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
   NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes");
 
   m_receiveBufferSize += nBytesReceived;
-  auto unparsedBytes = ndn::make_span(m_receiveBuffer).first(m_receiveBufferSize);
-  while (!unparsedBytes.empty()) {
-    auto [isOk, element] = Block::fromBuffer(unparsedBytes);
-    if (!isOk)
+  m_receivedPackets.clear();
+  while (m_receiveBufferStart < m_receiveBufferSize) {
+    auto [isOk, element] = m_receiveBuffer.decode(m_receiveBufferStart,
+                                                  m_receiveBufferSize - m_receiveBufferStart);
+    if (!isOk || element.size() > ndn::MAX_NDN_PACKET_SIZE)
       break;
 
-    unparsedBytes = unparsedBytes.subspan(element.size());
-    this->receive(element);
+    m_receiveBufferStart += element.size();
+    m_receivedPackets.push_back(std::move(element));
   }
 
-  if (unparsedBytes.empty()) {
-    // nothing left in the receive buffer
-    m_receiveBufferSize = 0;
+  if (!m_receivedPackets.empty()) {
+    deliverPackets(m_receivedPackets);
   }
-  else if (unparsedBytes.data() != m_receiveBuffer.data()) {
-    // move remaining unparsed bytes to the beginning of the receive buffer
-    std::copy(unparsedBytes.begin(), unparsedBytes.end(), m_receiveBuffer.begin());
-    m_receiveBufferSize = unparsedBytes.size();
-  }
-  else if (unparsedBytes.size() == m_receiveBuffer.size()) {
+
+  if (m_receiveBufferSize - m_receiveBufferStart >= ndn::MAX_NDN_PACKET_SIZE) {
     NFD_LOG_FACE_ERROR("Failed to parse incoming packet or packet too large to process");
     this->setState(TransportState::FAILED);
     doClose();
     return;
   }
 
+  if (m_receiveBufferStart == m_receiveBufferSize) {
+    // everything was parsed, start over from the beginning of the buffer
+    m_receiveBufferStart = m_receiveBufferSize = 0;
+    m_receiveBuffer.prepare();
+  }
+  else if (m_receiveBuffer.size() - m_receiveBufferSize < ndn::MAX_NDN_PACKET_SIZE) {
+    // move the unparsed bytes to the beginning of the receive buffer only when running out
+    // of space, the buffer may be replaced if received packets still reference it
+    m_receiveBufferSize -= m_receiveBufferStart;
+    m_receiveBuffer.prepare(m_receiveBufferStart, m_receiveBufferSize);
+    m_receiveBufferStart = 0;
+  }
+  // otherwise, keep receiving after the unparsed bytes; this never overwrites bytes
+  // referenced by received packets, because they all lie before m_receiveBufferStart
+
   startReceive();
 }
 
@@ -311,16 +377,17 @@ template<class T>
 void
 StreamTransport<T>::resetReceiveBuffer()
 {
-  m_receiveBufferSize = 0;
+  m_receiveBufferStart = m_receiveBufferSize = 0;
+  m_receiveBuffer.prepare();
 }
 
 template<class T>
 void
 StreamTransport<T>::resetSendQueue()
 {
-  std::queue<Block> emptyQueue;
-  std::swap(emptyQueue, m_sendQueue);
+  m_sendQueue.clear();
   m_sendQueueBytes = 0;
+  m_sendOffset = 0;
 }
 
 template<class T>
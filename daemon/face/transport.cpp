@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -94,7 +94,9 @@ Transport::send(const Block& packet)
     this->nOutBytes += packet.size();
   }
 
+  auto txTimer = m_txLatency.start();
   this->doSend(packet);
+  txTimer.stop();
 }
 
 void
@@ -107,7 +109,26 @@ Transport::receive(const Block& packet, const EndpointId& endpoint)
   ++this->nInPackets;
   this->nInBytes += packet.size();
 
+  auto rxTimer = m_rxLatency.start();
   m_service->receivePacket(packet, endpoint);
+  rxTimer.stop();
+}
+
+void
+Transport::receive(span<const Block> packets, const EndpointId& endpoint)
+{
+  for (const Block& packet : packets) {
+    BOOST_ASSERT(packet.isValid());
+    BOOST_ASSERT(this->getMtu() == MTU_UNLIMITED ||
+                 packet.size() <= static_cast<size_t>(this->getMtu()));
+
+    ++this->nInPackets;
+    this->nInBytes += packet.size();
+  }
+
+  auto rxTimer = m_rxLatency.start();
+  m_service->receivePackets(packets, endpoint);
+  rxTimer.stop(packets.size());
 }
 
 void
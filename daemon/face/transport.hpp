@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -28,6 +28,7 @@
 
 #include "face-common.hpp"
 #include "common/counter.hpp"
+#include "common/latency-sampler.hpp"
 
 namespace nfd::face {
 
@@ -93,6 +94,14 @@ public:
    * This counter is increased only when the transport is UP.
    */
   ByteCounter nOutBytes;
+
+  /**
+   * \brief Count of outgoing packets dropped by the transport, e.g., because its
+   *        transmit ring was full.
+   *
+   * Dropped packets are also counted in nOutPackets and nOutBytes.
+   */
+  PacketCounter nOutDropped;
 };
 
 /**
@@ -181,6 +190,27 @@ public:
     return *this;
   }
 
+  /**
+   * \brief Returns the latency histogram of received packets.
+   *
+   * A sample spans the processing of a received packet by the LinkService and the forwarder.
+   * When packets are received in a burst, the sample is the mean over the burst.
+   */
+  const LatencyHistogram&
+  getRxLatency() const noexcept
+  {
+    return m_rxLatency.getHistogram();
+  }
+
+  /**
+   * \brief Returns the latency histogram of handing packets to the underlying socket or queue.
+   */
+  const LatencyHistogram&
+  getTxLatency() const noexcept
+  {
+    return m_txLatency.getHistogram();
+  }
+
 public: // upper interface
   /** \brief Request the transport to be closed.
    *
@@ -338,6 +368,15 @@ protected: // upper interface to be invoked by subclass
   void
   receive(const Block& packet, const EndpointId& endpoint = {});
 
+  /**
+   * \brief Pass a burst of received link-layer packets to the upper layer, in order.
+   * \param packets The received packets, each must be a valid and well-formed TLV block
+   * \param endpoint The source endpoint of all packets, optional for unicast transports
+   * \warning Behavior is undefined if any packet size exceeds the MTU limit.
+   */
+  void
+  receive(span<const Block> packets, const EndpointId& endpoint = {});
+
 protected: // properties to be set by subclass
   void
   setLocalUri(const FaceUri& uri) noexcept
@@ -438,6 +477,8 @@ private:
   ssize_t m_sendQueueCapacity = QUEUE_UNSUPPORTED;
   TransportState m_state = TransportState::UP;
   time::steady_clock::time_point m_expirationTime = time::steady_clock::time_point::max();
+  LatencySampler m_rxLatency;
+  LatencySampler m_txLatency;
 };
 
 std::ostream&
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -97,7 +97,9 @@ void
 UdpChannel::waitForNewPeer(const FaceCreatedCallback& onFaceCreated,
                            const FaceCreationFailedCallback& onReceiveFailed)
 {
-  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_remoteEndpoint, [=] (auto&&... args) {
+  m_receiveBuffer.prepare();
+  m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer.data(), m_receiveBuffer.size()),
+                              m_remoteEndpoint, [=] (auto&&... args) {
     handleNewPeer(std::forward<decltype(args)>(args)..., onFaceCreated, onReceiveFailed);
   });
 }
@@ -117,6 +119,26 @@ UdpChannel::handleNewPeer(const boost::system::error_code& error,
     return;
   }
 
+  if (!dispatchDatagram(m_receiveBuffer, nBytesReceived, onFaceCreated, onReceiveFailed))
+    return;
+
+  // dispatch the datagrams already queued on the socket, if any
+  auto& batch = getDatagramBatch();
+  size_t nReceived = batch.receive(m_socket.native_handle());
+  for (size_t i = 0; i < nReceived; ++i) {
+    batch.getSender(i, m_remoteEndpoint);
+    if (!dispatchDatagram(batch.getBuffer(i), batch.getPayloadLength(i), onFaceCreated, onReceiveFailed))
+      return;
+  }
+
+  waitForNewPeer(onFaceCreated, onReceiveFailed);
+}
+
+bool
+UdpChannel::dispatchDatagram(const ReceiveBuffer& buffer, size_t nBytes,
+                             const FaceCreatedCallback& onFaceCreated,
+                             const FaceCreationFailedCallback& onReceiveFailed)
+{
   NFD_LOG_CHAN_TRACE("New peer " << m_remoteEndpoint);
 
   bool isCreated = false;
@@ -131,7 +153,7 @@ UdpChannel::handleNewPeer(const boost::system::error_code& error,
     NFD_LOG_CHAN_DEBUG("Face creation for " << m_remoteEndpoint << " failed: " << e.what());
     if (onReceiveFailed)
       onReceiveFailed(504, "Face creation failed: "s + e.what());
-    return;
+    return false;
   }
 
   if (isCreated)
@@ -141,9 +163,8 @@ UdpChannel::handleNewPeer(const boost::system::error_code& error,
 
   // dispatch the datagram to the face for processing
   auto* transport = static_cast<UnicastUdpTransport*>(face->getTransport());
-  transport->receiveDatagram(ndn::span(m_receiveBuffer).first(nBytesReceived), error);
-
-  waitForNewPeer(onFaceCreated, onReceiveFailed);
+  transport->receiveDatagram(buffer, nBytes, {});
+  return true;
 }
 
 std::pair<bool, shared_ptr<Face>>
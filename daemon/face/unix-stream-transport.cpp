@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -25,12 +25,116 @@
 
 #include "unix-stream-transport.hpp"
 
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+#if defined(__linux__)
+#include "shm-ring.hpp"
+
+#include <boost/asio/posix/stream_descriptor.hpp>
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
 namespace nfd::face {
 
 namespace local = boost::asio::local;
 
 NFD_LOG_MEMBER_INIT_SPECIALIZED(StreamTransport<local::stream_protocol>, UnixStreamTransport);
 
+#if defined(__linux__)
+
+/// Maximum number of packets taken from the receive ring before yielding to other handlers
+constexpr size_t MAX_SHM_RECEIVE_BATCH = 256;
+
+struct UnixStreamTransport::SharedMemory
+{
+  explicit
+  SharedMemory(size_t capacity)
+    : capacity(capacity)
+    , regionSize(2 * ShmRing::getRegionSize(capacity))
+    , rxEvent(getGlobalIoService())
+  {
+  }
+
+  /**
+   * \brief Creates the shared memory region, the eventfds, and the rings.
+   * \throw std::runtime_error a system call failed; the destructor releases what was created
+   */
+  void
+  create()
+  {
+    memfd = ::memfd_create("nfd-face", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (memfd < 0) {
+      NDN_THROW(std::runtime_error("memfd_create: "s + std::strerror(errno)));
+    }
+    if (::ftruncate(memfd, static_cast<off_t>(regionSize)) < 0) {
+      NDN_THROW(std::runtime_error("ftruncate: "s + std::strerror(errno)));
+    }
+    // the client must not be able to shrink the region, which would make accesses
+    // to the mapping raise SIGBUS in NFD
+    if (::fcntl(memfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) < 0) {
+      NDN_THROW(std::runtime_error("fcntl(F_ADD_SEALS): "s + std::strerror(errno)));
+    }
+    void* addr = ::mmap(nullptr, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    if (addr == MAP_FAILED) {
+      NDN_THROW(std::runtime_error("mmap: "s + std::strerror(errno)));
+    }
+    region = static_cast<uint8_t*>(addr);
+
+    int rxFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (rxFd < 0) {
+      NDN_THROW(std::runtime_error("eventfd: "s + std::strerror(errno)));
+    }
+    rxEvent.assign(rxFd);
+    txEventFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (txEventFd < 0) {
+      NDN_THROW(std::runtime_error("eventfd: "s + std::strerror(errno)));
+    }
+
+    rx.emplace(region, capacity, true);
+    tx.emplace(region + ShmRing::getRegionSize(capacity), capacity, true);
+  }
+
+  ~SharedMemory()
+  {
+    if (region != nullptr) {
+      ::munmap(region, regionSize);
+    }
+    if (memfd >= 0) {
+      ::close(memfd);
+    }
+    if (txEventFd >= 0) {
+      ::close(txEventFd);
+    }
+  }
+
+  const size_t capacity;
+  const size_t regionSize;
+  uint8_t* region = nullptr;
+  int memfd = -1; ///< closed once it has been passed to the client
+  boost::asio::posix::stream_descriptor rxEvent; ///< written by the client
+  int txEventFd = -1; ///< written by the transport
+  std::optional<ShmRing> rx; ///< packets from the client
+  std::optional<ShmRing> tx; ///< packets to the client
+  std::deque<Block> overflow; ///< packets that did not fit in the tx ring, in order
+  size_t overflowBytes = 0;
+  bool hasPendingSignal = false;
+};
+
+#else
+
+struct UnixStreamTransport::SharedMemory
+{
+};
+
+#endif // defined(__linux__)
+
 UnixStreamTransport::UnixStreamTransport(local::stream_protocol::socket&& socket)
   : StreamTransport(std::move(socket))
 {
@@ -49,4 +153,265 @@ UnixStreamTransport::UnixStreamTransport(local::stream_protocol::socket&& socket
   NFD_LOG_FACE_DEBUG("Creating transport");
 }
 
+UnixStreamTransport::~UnixStreamTransport() = default;
+
+ssize_t
+UnixStreamTransport::getSendQueueLength()
+{
+  ssize_t queueLength = StreamTransport::getSendQueueLength();
+#if defined(__linux__)
+  if (m_shm != nullptr) {
+    queueLength += m_shm->overflowBytes;
+  }
+#endif
+  return queueLength;
+}
+
+void
+UnixStreamTransport::doClose()
+{
+#if defined(__linux__)
+  if (m_shm != nullptr && m_shm->rxEvent.is_open()) {
+    // use the non-throwing variant and ignore errors, if any
+    boost::system::error_code error;
+    m_shm->rxEvent.close(error);
+  }
+#endif
+
+  StreamTransport::doClose();
+}
+
+void
+UnixStreamTransport::doSend(const Block& packet)
+{
+#if defined(__linux__)
+  if (m_shm != nullptr) {
+    NFD_LOG_FACE_TRACE(__func__);
+
+    if (getState() != TransportState::UP)
+      return;
+
+    auto& shm = *m_shm;
+    if (!shm.overflow.empty() || !shm.tx->push(packet)) {
+      // a client that stops reading must not make the overflow queue grow without bound
+      if (shm.overflowBytes + packet.size() > SHM_OVERFLOW_LIMIT) {
+        NFD_LOG_FACE_DEBUG("Shared memory send queue is full, dropping packet of "
+                           << packet.size() << " bytes");
+        return;
+      }
+      shm.overflow.push_back(packet);
+      shm.overflowBytes += packet.size();
+      pushShmOverflow();
+    }
+    signalShmSend();
+    return;
+  }
+#endif
+
+  StreamTransport::doSend(packet);
+}
+
+void
+UnixStreamTransport::deliverPackets(span<const Block> packets)
+{
+  if (!m_hasReceived) {
+    m_hasReceived = true;
+    if (packets.front().type() == SHM_HANDSHAKE_TYPE) {
+#if defined(__linux__)
+      startSharedMemory();
+#else
+      // shared memory is not supported on this platform
+      StreamTransport::doSend(ndn::encoding::makeNonNegativeIntegerBlock(SHM_HANDSHAKE_TYPE, 0));
+#endif
+      packets = packets.subspan(1);
+      if (packets.empty())
+        return;
+    }
+  }
+
+  this->receive(packets);
+}
+
+#if defined(__linux__)
+
+void
+UnixStreamTransport::startSharedMemory()
+{
+  // the reply must be the next bytes written to the socket, which cannot be guaranteed
+  // if other packets are still waiting to be written
+  if (getSendQueueBytes() > 0) {
+    NFD_LOG_FACE_WARN("Cannot switch to shared memory while packets are queued");
+    StreamTransport::doSend(ndn::encoding::makeNonNegativeIntegerBlock(SHM_HANDSHAKE_TYPE, 0));
+    return;
+  }
+
+  auto shm = make_unique<SharedMemory>(SHM_RING_CAPACITY);
+  try {
+    shm->create();
+  }
+  catch (const std::runtime_error& e) {
+    NFD_LOG_FACE_WARN("Cannot switch to shared memory: " << e.what());
+    StreamTransport::doSend(ndn::encoding::makeNonNegativeIntegerBlock(SHM_HANDSHAKE_TYPE, 0));
+    return;
+  }
+
+  const int fds[] = {shm->memfd, shm->rxEvent.native_handle(), shm->txEventFd};
+  sendHandshakeReply(ndn::encoding::makeNonNegativeIntegerBlock(SHM_HANDSHAKE_TYPE, SHM_RING_CAPACITY),
+                     fds);
+  if (getState() != TransportState::UP) {
+    return;
+  }
+
+  // the client has its own mapping now
+  ::close(shm->memfd);
+  shm->memfd = -1;
+  m_shm = std::move(shm);
+  NFD_LOG_FACE_DEBUG("Switched to shared memory, ring capacity " << SHM_RING_CAPACITY);
+
+  waitForShmEvent();
+}
+
+void
+UnixStreamTransport::sendHandshakeReply(const Block& reply, span<const int> fds)
+{
+  iovec iov{};
+  iov.iov_base = const_cast<uint8_t*>(reply.data());
+  iov.iov_len = reply.size();
+
+  alignas(cmsghdr) char control[CMSG_SPACE(3 * sizeof(int))] = {};
+  BOOST_ASSERT(fds.size_bytes() <= 3 * sizeof(int));
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = CMSG_SPACE(fds.size_bytes());
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(fds.size_bytes());
+  std::memcpy(CMSG_DATA(cmsg), fds.data(), fds.size_bytes());
+
+  // the send queue is empty and the reply is tiny, so the socket buffer can take it at once;
+  // a short or failed write would leave the stream in an unknown state
+  ssize_t nSent = ::sendmsg(m_socket.native_handle(), &msg, MSG_NOSIGNAL);
+  if (nSent != static_cast<ssize_t>(reply.size())) {
+    NFD_LOG_FACE_ERROR("Failed to send shared memory handshake reply: " <<
+                       (nSent < 0 ? std::strerror(errno) : "short write"));
+    this->setState(TransportState::FAILED);
+    doClose();
+  }
+}
+
+void
+UnixStreamTransport::waitForShmEvent()
+{
+  m_shm->rxEvent.async_wait(boost::asio::posix::stream_descriptor::wait_read,
+                            [this] (const auto& error) { handleShmEvent(error); });
+}
+
+void
+UnixStreamTransport::handleShmEvent(const boost::system::error_code& error)
+{
+  if (error) {
+    if (error != boost::asio::error::operation_aborted && getState() == TransportState::UP) {
+      NFD_LOG_FACE_ERROR("Failed to wait for shared memory event: " << error.message());
+      this->setState(TransportState::FAILED);
+      doClose();
+    }
+    return;
+  }
+
+  auto& shm = *m_shm;
+  uint64_t counter;
+  // reset the eventfd counter; EAGAIN means it was reset by a previous call already
+  [[maybe_unused]] auto nRead = ::read(shm.rxEvent.native_handle(), &counter, sizeof(counter));
+
+  std::vector<Block> packets;
+  while (packets.size() < MAX_SHM_RECEIVE_BATCH) {
+    auto wire = shm.rx->front();
+    if (wire.empty()) {
+      if (shm.rx->isCorrupted()) {
+        NFD_LOG_FACE_ERROR("Shared memory ring from the client is corrupted");
+        this->setState(TransportState::FAILED);
+        doClose();
+        return;
+      }
+      break;
+    }
+
+    auto [isOk, element] = Block::fromBuffer(wire);
+    if (!isOk || element.size() != wire.size() || element.size() > ndn::MAX_NDN_PACKET_SIZE) {
+      NFD_LOG_FACE_ERROR("Failed to parse packet from shared memory or packet too large to process");
+      this->setState(TransportState::FAILED);
+      doClose();
+      return;
+    }
+    shm.rx->pop();
+    packets.push_back(std::move(element));
+  }
+
+  // popping made room in the client's ring
+  if (!packets.empty() && shm.rx->clearProducerWaiting()) {
+    signalShmSend();
+  }
+
+  // the client may have made room in the tx ring for packets that did not fit earlier
+  pushShmOverflow();
+
+  if (!packets.empty()) {
+    this->receive(packets);
+    if (getState() != TransportState::UP)
+      return;
+  }
+
+  if (packets.size() == MAX_SHM_RECEIVE_BATCH) {
+    // more packets may be pending, continue after other handlers had a chance to run
+    boost::asio::defer(getGlobalIoService(), [this] {
+      if (getState() == TransportState::UP)
+        handleShmEvent({});
+    });
+  }
+  else {
+    waitForShmEvent();
+  }
+}
+
+void
+UnixStreamTransport::pushShmOverflow()
+{
+  auto& shm = *m_shm;
+  bool isWaiting = false;
+  while (!shm.overflow.empty()) {
+    if (!shm.tx->push(shm.overflow.front())) {
+      if (isWaiting)
+        break;
+      // ask the client to signal once it makes room, then check again in case it
+      // has done so in the meantime
+      shm.tx->setProducerWaiting();
+      isWaiting = true;
+      continue;
+    }
+    shm.overflowBytes -= shm.overflow.front().size();
+    shm.overflow.pop_front();
+  }
+}
+
+void
+UnixStreamTransport::signalShmSend()
+{
+  if (m_shm->hasPendingSignal)
+    return;
+
+  // packets sent during the current turn of the event loop are announced with a single write
+  m_shm->hasPendingSignal = true;
+  boost::asio::defer(getGlobalIoService(), [this] {
+    m_shm->hasPendingSignal = false;
+    uint64_t one = 1;
+    // EAGAIN means the counter is saturated, the client will be woken up anyway
+    [[maybe_unused]] auto nWritten = ::write(m_shm->txEventFd, &one, sizeof(one));
+  });
+}
+
+#endif // defined(__linux__)
+
 } // namespace nfd::face
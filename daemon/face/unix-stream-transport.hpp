@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -40,12 +40,86 @@ NFD_LOG_MEMBER_DECL_SPECIALIZED(StreamTransport<boost::asio::local::stream_proto
 
 /**
  * \brief A Transport that communicates on a stream-oriented Unix domain socket.
+ *
+ * On Linux, a co-located client can switch the transport to shared memory, which avoids
+ * copying packets through the kernel. To do so, the first packet sent by the client must be
+ * a TLV element of type #SHM_HANDSHAKE_TYPE with empty value. The transport replies with an
+ * element of the same type whose value is the ring capacity as a NonNegativeInteger, and
+ * passes three file descriptors in the same message (SCM_RIGHTS):
+ *  1. a memfd containing two ShmRing instances of that capacity, the ring for packets from
+ *     the client at offset 0, followed by the ring for packets to the client; the memfd is
+ *     sealed, so that the client cannot resize it;
+ *  2. an eventfd that the client writes to after pushing packets, or after popping packets
+ *     when the transport was waiting for free space;
+ *  3. an eventfd that the transport writes to in the same circumstances.
+ *
+ * If the transport cannot switch, the reply carries a capacity of 0 and packets keep being
+ * exchanged on the socket. The socket stays open in either case; closing it closes the face.
+ * The face fails if the client writes an invalid record into its ring. Packets that do not fit
+ * in the ring to the client are queued up to #SHM_OVERFLOW_LIMIT bytes and dropped beyond that.
  */
 class UnixStreamTransport final : public StreamTransport<boost::asio::local::stream_protocol>
 {
 public:
   explicit
   UnixStreamTransport(boost::asio::local::stream_protocol::socket&& socket);
+
+  ~UnixStreamTransport() override;
+
+  ssize_t
+  getSendQueueLength() final;
+
+  /**
+   * \brief Returns whether packets are exchanged over shared memory.
+   */
+  bool
+  isUsingSharedMemory() const noexcept
+  {
+    return m_shm != nullptr;
+  }
+
+public:
+  /// TLV-TYPE of the shared memory handshake request and reply
+  static constexpr uint32_t SHM_HANDSHAKE_TYPE = 0x9F40;
+  /// Capacity of each shared memory ring
+  static constexpr size_t SHM_RING_CAPACITY = 1 << 22;
+  /// Maximum number of bytes queued for sending when the ring to the client is full
+  static constexpr size_t SHM_OVERFLOW_LIMIT = SHM_RING_CAPACITY;
+
+private:
+  void
+  doClose() final;
+
+  void
+  doSend(const Block& packet) final;
+
+  void
+  deliverPackets(span<const Block> packets) final;
+
+#if defined(__linux__)
+  void
+  startSharedMemory();
+
+  void
+  sendHandshakeReply(const Block& reply, span<const int> fds);
+
+  void
+  waitForShmEvent();
+
+  void
+  handleShmEvent(const boost::system::error_code& error);
+
+  void
+  pushShmOverflow();
+
+  void
+  signalShmSend();
+#endif
+
+private:
+  struct SharedMemory;
+  unique_ptr<SharedMemory> m_shm;
+  bool m_hasReceived = false;
 };
 
 } // namespace nfd::face
@@ -0,0 +1,58 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "forwarder-latency.hpp"
+
+namespace nfd {
+
+std::ostream&
+operator<<(std::ostream& os, ForwarderStage stage)
+{
+  switch (stage) {
+  case ForwarderStage::INCOMING_INTEREST:
+    return os << "incoming-interest";
+  case ForwarderStage::PIT_INSERT:
+    return os << "pit-insert";
+  case ForwarderStage::CS_LOOKUP:
+    return os << "cs-lookup";
+  case ForwarderStage::STRATEGY_INTEREST:
+    return os << "strategy-interest";
+  case ForwarderStage::OUTGOING_INTEREST:
+    return os << "outgoing-interest";
+  case ForwarderStage::INCOMING_DATA:
+    return os << "incoming-data";
+  case ForwarderStage::PIT_MATCH:
+    return os << "pit-match";
+  case ForwarderStage::STRATEGY_DATA:
+    return os << "strategy-data";
+  case ForwarderStage::OUTGOING_DATA:
+    return os << "outgoing-data";
+  case ForwarderStage::INCOMING_NACK:
+    return os << "incoming-nack";
+  }
+  return os << "none";
+}
+
+} // namespace nfd
@@ -0,0 +1,83 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_FORWARDER_LATENCY_HPP
+#define NFD_DAEMON_FW_FORWARDER_LATENCY_HPP
+
+#include "common/latency-sampler.hpp"
+
+#include <array>
+
+namespace nfd {
+
+/**
+ * \brief Stages of the forwarding pipelines whose latency is measured.
+ */
+enum class ForwarderStage : uint8_t {
+  INCOMING_INTEREST, ///< whole incoming Interest pipeline, including the stages it enters
+  PIT_INSERT,        ///< PIT insert in incoming Interest pipeline
+  CS_LOOKUP,         ///< Content Store lookup
+  STRATEGY_INTEREST, ///< strategy's afterReceiveInterest trigger
+  OUTGOING_INTEREST, ///< sending an Interest on the egress face
+  INCOMING_DATA,     ///< whole incoming Data pipeline, including the stages it enters
+  PIT_MATCH,         ///< PIT lookup for the entries that an incoming Data satisfies
+  STRATEGY_DATA,     ///< strategy's afterReceiveData or beforeSatisfyInterest trigger
+  OUTGOING_DATA,     ///< sending a Data on the egress face
+  INCOMING_NACK,     ///< whole incoming Nack pipeline, including the stages it enters
+};
+
+inline constexpr size_t N_FORWARDER_STAGES = static_cast<size_t>(ForwarderStage::INCOMING_NACK) + 1;
+
+/**
+ * \brief Prints the label of \p stage in the latency dataset, e.g., "pit-insert".
+ */
+std::ostream&
+operator<<(std::ostream& os, ForwarderStage stage);
+
+/**
+ * \brief Latency histograms provided by Forwarder, one per pipeline stage.
+ */
+class ForwarderLatency : noncopyable
+{
+public:
+  LatencySampler&
+  operator[](ForwarderStage stage) noexcept
+  {
+    return m_samplers[static_cast<size_t>(stage)];
+  }
+
+  const LatencySampler&
+  operator[](ForwarderStage stage) const noexcept
+  {
+    return m_samplers[static_cast<size_t>(stage)];
+  }
+
+private:
+  std::array<LatencySampler, N_FORWARDER_STAGES> m_samplers;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_FORWARDER_LATENCY_HPP
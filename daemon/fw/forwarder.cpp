@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -29,7 +29,6 @@
 #include "best-route-strategy.hpp"
 #include "scope-prefix.hpp"
 #include "strategy.hpp"
-#include "common/global.hpp"
 #include "common/logger.hpp"
 #include "table/cleanup.hpp"
 
@@ -69,6 +68,10 @@ Forwarder::Forwarder(FaceTable& faceTable)
       [this, &face] (const lp::Nack& nack, const EndpointId& endpointId) {
         this->onIncomingNack(nack, FaceEndpoint(const_cast<Face&>(face), endpointId));
       });
+    face.afterReceiveBatch.connect(
+      [this, &face] (span<const face::ReceivedPacket> packets) {
+        this->onIncomingBatch(const_cast<Face&>(face), packets);
+      });
     face.onDroppedInterest.connect(
       [this, &face] (const Interest& interest) {
         this->onDroppedInterest(interest, const_cast<Face&>(face));
@@ -86,9 +89,60 @@ Forwarder::Forwarder(FaceTable& faceTable)
   m_strategyChoice.setDefaultStrategy(getDefaultStrategyName());
 }
 
+// Returns the hash values of the name that the incoming pipelines look up for a received packet.
+// They are cached on the packet, so that the pipelines do not compute them again.
+static const name_tree::HashSequence&
+getReceivedPacketHashes(const face::ReceivedPacket& received)
+{
+  if (auto interest = std::get_if<shared_ptr<const Interest>>(&received.packet)) {
+    return name_tree::getHashes(**interest);
+  }
+  if (auto data = std::get_if<shared_ptr<const Data>>(&received.packet)) {
+    return name_tree::getHashes(**data);
+  }
+  return name_tree::getHashes(std::get<shared_ptr<const lp::Nack>>(received.packet)->getInterest());
+}
+
+void
+Forwarder::onIncomingBatch(Face& face, span<const face::ReceivedPacket> packets)
+{
+  // Software pipelining: NameTree buckets are prefetched two packets ahead and nodes one packet
+  // ahead, so that their memory accesses overlap with the processing of the current packet.
+  // The lookups themselves stay in the pipelines, because a packet can create or erase the
+  // entries that the next packet finds.
+  size_t n = packets.size();
+  if (n > 1) {
+    m_nameTree.prefetchBuckets(getReceivedPacketHashes(packets[0]));
+    m_nameTree.prefetchBuckets(getReceivedPacketHashes(packets[1]));
+    m_nameTree.prefetchNodes(getReceivedPacketHashes(packets[0]));
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    if (i + 2 < n) {
+      m_nameTree.prefetchBuckets(getReceivedPacketHashes(packets[i + 2]));
+    }
+    if (i + 1 < n) {
+      m_nameTree.prefetchNodes(getReceivedPacketHashes(packets[i + 1]));
+    }
+
+    const auto& received = packets[i];
+    FaceEndpoint ingress(face, received.endpoint);
+    if (auto interest = std::get_if<shared_ptr<const Interest>>(&received.packet)) {
+      this->onIncomingInterest(**interest, ingress);
+    }
+    else if (auto data = std::get_if<shared_ptr<const Data>>(&received.packet)) {
+      this->onIncomingData(**data, ingress);
+    }
+    else {
+      this->onIncomingNack(*std::get<shared_ptr<const lp::Nack>>(received.packet), ingress);
+    }
+  }
+}
+
 void
 Forwarder::onIncomingInterest(const Interest& interest, const FaceEndpoint& ingress)
 {
+  LatencySampler::Scope latencyScope(m_latency[ForwarderStage::INCOMING_INTEREST]);
   interest.setTag(make_shared<lp::IncomingFaceIdTag>(ingress.face.getId()));
   ++m_counters.nInInterests;
 
@@ -120,7 +174,9 @@ Forwarder::onIncomingInterest(const Interest& interest, const FaceEndpoint& ingr
   }
 
   // detect duplicate Nonce with Dead Nonce List
-  bool hasDuplicateNonceInDnl = m_deadNonceList.has(interest.getName(), nonce);
+  // (the name hashes are computed here once, and reused by the PIT and other tables)
+  bool hasDuplicateNonceInDnl = m_deadNonceList.has(interest.getName(),
+                                                    name_tree::getHashes(interest), nonce);
   if (hasDuplicateNonceInDnl) {
     // go to Interest loop pipeline
     this->onInterestLoop(interest, ingress);
@@ -136,7 +192,9 @@ Forwarder::onIncomingInterest(const Interest& interest, const FaceEndpoint& ingr
   }
 
   // PIT insert
+  auto pitInsertTimer = m_latency[ForwarderStage::PIT_INSERT].start();
   shared_ptr<pit::Entry> pitEntry = m_pit.insert(interest).first;
+  pitInsertTimer.stop();
 
   // detect duplicate Nonce in PIT entry
   int dnw = fw::findDuplicateNonce(*pitEntry, nonce, ingress.face);
@@ -153,15 +211,72 @@ Forwarder::onIncomingInterest(const Interest& interest, const FaceEndpoint& ingr
 
   // is pending?
   if (!pitEntry->hasInRecords()) {
-    m_cs.find(interest,
-              [=] (const Interest& i, const Data& d) { onContentStoreHit(i, ingress, pitEntry, d); },
-              [=] (const Interest& i) { onContentStoreMiss(i, ingress, pitEntry); });
+    // the lookup ends when either callback is invoked, which happens after find() returns
+    // if the lookup continues in the disk tier of the CS
+    auto csLookupTimer = m_latency[ForwarderStage::CS_LOOKUP].start();
+    FaceId ingressFaceId = ingress.face.getId();
+    bool wasInCsLookup = std::exchange(m_isInCsLookup, true);
+    bool isPending = m_cs.find(interest,
+              [=] (const Interest& i, const Data& d) {
+                csLookupTimer.stop();
+                if (m_isInCsLookup || canResumeAfterCsLookup(i, ingressFaceId, pitEntry)) {
+                  onContentStoreHit(i, ingress, pitEntry, d);
+                }
+              },
+              [=] (const Interest& i) {
+                csLookupTimer.stop();
+                if (m_isInCsLookup || canResumeAfterCsLookup(i, ingressFaceId, pitEntry)) {
+                  onContentStoreMiss(i, ingress, pitEntry);
+                }
+              });
+    m_isInCsLookup = wasInCsLookup;
+
+    if (isPending) {
+      // the in-record lets duplicate Nonces be detected and aggregates retransmissions while
+      // the disk tier is read, and the expiry timer erases the entry if the read never returns
+      NFD_LOG_DEBUG("onIncomingInterest in=" << ingress << " interest=" << interest.getName()
+                    << " nonce=" << nonce << " cs-lookup-pending");
+      pitEntry->hasPendingCsLookup = true;
+      pitEntry->insertOrUpdateInRecord(ingress.face, interest);
+      this->setExpiryTimerToLastInRecord(pitEntry);
+    }
+  }
+  else if (pitEntry->hasPendingCsLookup) {
+    // wait for the pending lookup, whose result also answers this Interest
+    NFD_LOG_DEBUG("onIncomingInterest in=" << ingress << " interest=" << interest.getName()
+                  << " nonce=" << nonce << " aggregated-in-cs-lookup");
+    pitEntry->insertOrUpdateInRecord(ingress.face, interest);
+    this->setExpiryTimerToLastInRecord(pitEntry);
   }
   else {
     this->onContentStoreMiss(interest, ingress, pitEntry);
   }
 }
 
+bool
+Forwarder::canResumeAfterCsLookup(const Interest& interest, FaceId ingressFaceId,
+                                  const shared_ptr<pit::Entry>& pitEntry)
+{
+  if (m_pit.find(interest) != pitEntry) {
+    NFD_LOG_DEBUG("onContentStoreLookup interest=" << interest.getName()
+                  << " nonce=" << interest.getNonce() << " pit-entry-gone -> DROP");
+    return false;
+  }
+  pitEntry->hasPendingCsLookup = false;
+
+  // FaceIds are not reused, so a face with this FaceId is the original ingress face
+  if (m_faceTable.get(ingressFaceId) == nullptr) {
+    NFD_LOG_DEBUG("onContentStoreLookup interest=" << interest.getName()
+                  << " nonce=" << interest.getNonce() << " in=" << ingressFaceId << " face-gone -> DROP");
+    if (!pitEntry->hasInRecords()) {
+      // no other pipeline will set an expiry timer on this PIT entry
+      this->setExpiryTimer(pitEntry, 0_ms);
+    }
+    return false;
+  }
+  return true;
+}
+
 void
 Forwarder::onInterestLoop(const Interest& interest, const FaceEndpoint& ingress)
 {
@@ -176,7 +291,7 @@ Forwarder::onInterestLoop(const Interest& interest, const FaceEndpoint& ingress)
                 << " nonce=" << interest.getNonce());
 
   // leave loop handling up to the strategy (e.g., whether to reply with a Nack)
-  m_strategyChoice.findEffectiveStrategy(interest.getName()).onInterestLoop(interest, ingress);
+  m_strategyChoice.findEffectiveStrategy(interest).onInterestLoop(interest, ingress);
 }
 
 void
@@ -195,12 +310,7 @@ Forwarder::onContentStoreMiss(const Interest& interest, const FaceEndpoint& ingr
   pitEntry->insertOrUpdateInRecord(ingress.face, interest);
 
   // set PIT expiry timer to the time that the last PIT in-record expires
-  auto lastExpiring = std::max_element(pitEntry->in_begin(), pitEntry->in_end(),
-                                       [] (const auto& a, const auto& b) {
-                                         return a.getExpiry() < b.getExpiry();
-                                       });
-  auto lastExpiryFromNow = lastExpiring->getExpiry() - time::steady_clock::now();
-  this->setExpiryTimer(pitEntry, time::duration_cast<time::milliseconds>(lastExpiryFromNow));
+  this->setExpiryTimerToLastInRecord(pitEntry);
 
   // has NextHopFaceId?
   auto nextHopTag = interest.getTag<lp::NextHopFaceIdTag>();
@@ -218,6 +328,7 @@ Forwarder::onContentStoreMiss(const Interest& interest, const FaceEndpoint& ingr
   }
 
   // dispatch to strategy: after receive Interest
+  LatencySampler::Scope latencyScope(m_latency[ForwarderStage::STRATEGY_INTEREST]);
   m_strategyChoice.findEffectiveStrategy(*pitEntry)
     .afterReceiveInterest(interest, FaceEndpoint(ingress.face), pitEntry);
 }
@@ -242,6 +353,16 @@ Forwarder::onContentStoreHit(const Interest& interest, const FaceEndpoint& ingre
 
   // dispatch to strategy: after Content Store hit
   m_strategyChoice.findEffectiveStrategy(*pitEntry).afterContentStoreHit(data, ingress, pitEntry);
+
+  // answer the Interests from other faces that were aggregated while the disk tier was read
+  auto now = time::steady_clock::now();
+  for (const pit::InRecord& inRecord : pitEntry->getInRecords()) {
+    if (&inRecord.getFace() != &ingress.face && inRecord.getExpiry() > now) {
+      Data data2 = data; // each downstream gets its own PIT token
+      data2.setTag(inRecord.getInterest().getTag<lp::PitToken>());
+      this->onOutgoingData(data2, inRecord.getFace());
+    }
+  }
 }
 
 pit::OutRecord*
@@ -267,7 +388,9 @@ Forwarder::onOutgoingInterest(const Interest& interest, Face& egress,
   BOOST_ASSERT(it != pitEntry->out_end());
 
   // send Interest
+  auto sendTimer = m_latency[ForwarderStage::OUTGOING_INTEREST].start();
   egress.sendInterest(interest);
+  sendTimer.stop();
   ++m_counters.nOutInterests;
 
   return &*it;
@@ -298,6 +421,7 @@ Forwarder::onInterestFinalize(const shared_ptr<pit::Entry>& pitEntry)
 void
 Forwarder::onIncomingData(const Data& data, const FaceEndpoint& ingress)
 {
+  LatencySampler::Scope latencyScope(m_latency[ForwarderStage::INCOMING_DATA]);
   data.setTag(make_shared<lp::IncomingFaceIdTag>(ingress.face.getId()));
   ++m_counters.nInData;
   NFD_LOG_DEBUG("onIncomingData in=" << ingress << " data=" << data.getName());
@@ -312,7 +436,9 @@ Forwarder::onIncomingData(const Data& data, const FaceEndpoint& ingress)
   }
 
   // PIT match
+  auto pitMatchTimer = m_latency[ForwarderStage::PIT_MATCH].start();
   pit::DataMatchResult pitMatches = m_pit.findAllDataMatches(data);
+  pitMatchTimer.stop();
   if (pitMatches.size() == 0) {
     // go to Data unsolicited pipeline
     this->onDataUnsolicited(data, ingress);
@@ -332,7 +458,9 @@ Forwarder::onIncomingData(const Data& data, const FaceEndpoint& ingress)
     this->setExpiryTimer(pitEntry, 0_ms);
 
     // trigger strategy: after receive Data
+    auto strategyTimer = m_latency[ForwarderStage::STRATEGY_DATA].start();
     m_strategyChoice.findEffectiveStrategy(*pitEntry).afterReceiveData(data, ingress, pitEntry);
+    strategyTimer.stop();
 
     // mark PIT satisfied
     pitEntry->isSatisfied = true;
@@ -365,7 +493,9 @@ Forwarder::onIncomingData(const Data& data, const FaceEndpoint& ingress)
       this->setExpiryTimer(pitEntry, 0_ms);
 
       // invoke PIT satisfy callback
+      auto strategyTimer = m_latency[ForwarderStage::STRATEGY_DATA].start();
       m_strategyChoice.findEffectiveStrategy(*pitEntry).beforeSatisfyInterest(data, ingress, pitEntry);
+      strategyTimer.stop();
 
       // mark PIT satisfied
       pitEntry->isSatisfied = true;
@@ -425,7 +555,9 @@ Forwarder::onOutgoingData(const Data& data, Face& egress)
   NFD_LOG_DEBUG("onOutgoingData out=" << egress.getId() << " data=" << data.getName());
 
   // send Data
+  auto sendTimer = m_latency[ForwarderStage::OUTGOING_DATA].start();
   egress.sendData(data);
+  sendTimer.stop();
   ++m_counters.nOutData;
 
   return true;
@@ -434,6 +566,7 @@ Forwarder::onOutgoingData(const Data& data, Face& egress)
 void
 Forwarder::onIncomingNack(const lp::Nack& nack, const FaceEndpoint& ingress)
 {
+  LatencySampler::Scope latencyScope(m_latency[ForwarderStage::INCOMING_NACK]);
   nack.setTag(make_shared<lp::IncomingFaceIdTag>(ingress.face.getId()));
   ++m_counters.nInNacks;
 
@@ -535,7 +668,7 @@ void
 Forwarder::onDroppedInterest(const Interest& interest, Face& egress)
 {
   NFD_LOG_DEBUG("onDroppedInterest out=" << egress.getId() << " interest=" << interest.getName());
-  m_strategyChoice.findEffectiveStrategy(interest.getName()).onDroppedInterest(interest, egress);
+  m_strategyChoice.findEffectiveStrategy(interest).onDroppedInterest(interest, egress);
 }
 
 void
@@ -567,8 +700,19 @@ Forwarder::setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::millisec
   BOOST_ASSERT(pitEntry);
   duration = std::max(duration, 0_ms);
 
-  pitEntry->expiryTimer.cancel();
-  pitEntry->expiryTimer = getScheduler().schedule(duration, [=] { onInterestFinalize(pitEntry); });
+  m_pitExpiryWheel.schedule(pitEntry->expiryTimer, duration, [=] { onInterestFinalize(pitEntry); });
+}
+
+void
+Forwarder::setExpiryTimerToLastInRecord(const shared_ptr<pit::Entry>& pitEntry)
+{
+  BOOST_ASSERT(pitEntry->hasInRecords());
+  auto lastExpiring = std::max_element(pitEntry->in_begin(), pitEntry->in_end(),
+                                       [] (const auto& a, const auto& b) {
+                                         return a.getExpiry() < b.getExpiry();
+                                       });
+  auto lastExpiryFromNow = lastExpiring->getExpiry() - time::steady_clock::now();
+  this->setExpiryTimer(pitEntry, time::duration_cast<time::milliseconds>(lastExpiryFromNow));
 }
 
 void
@@ -587,17 +731,18 @@ Forwarder::insertDeadNonceList(pit::Entry& pitEntry, const Face* upstream)
   }
 
   // Dead Nonce List insert
+  const auto& hashes = name_tree::getHashes(pitEntry.getInterest());
   if (upstream == nullptr) {
     // insert all outgoing Nonces
     std::for_each(pitEntry.out_begin(), pitEntry.out_end(), [&] (const auto& outRecord) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord.getLastNonce());
+      m_deadNonceList.add(pitEntry.getName(), hashes, outRecord.getLastNonce());
     });
   }
   else {
     // insert outgoing Nonce of a specific face
     auto outRecord = pitEntry.findOutRecord(*upstream);
     if (outRecord != pitEntry.out_end()) {
-      m_deadNonceList.add(pitEntry.getName(), outRecord->getLastNonce());
+      m_deadNonceList.add(pitEntry.getName(), hashes, outRecord->getLastNonce());
     }
   }
 }
@@ -620,6 +765,28 @@ Forwarder::processConfig(const ConfigSection& configSection, bool isDryRun, cons
     if (key == "default_hop_limit") {
       config.defaultHopLimit = ConfigFile::parseNumber<uint8_t>(pair, CFG_FORWARDER);
     }
+    else if (key == "dead_nonce_list_storage") {
+      const auto& value = pair.second.get_value<std::string>();
+      if (value == "exact") {
+        config.deadNonceListStorage = DeadNonceListStorage::EXACT;
+      }
+      else if (value == "filter") {
+        config.deadNonceListStorage = DeadNonceListStorage::FILTER;
+      }
+      else {
+        NDN_THROW(ConfigFile::Error("Invalid value '" + value + "' for option '" +
+                                    key + "' in section '" + CFG_FORWARDER + "'"));
+      }
+    }
+    else if (key == "latency_sampling_interval") {
+      auto interval = ConfigFile::parseNumber<uint32_t>(pair, CFG_FORWARDER);
+      if ((interval & (interval - 1)) != 0) {
+        NDN_THROW(ConfigFile::Error("Invalid value '" + std::to_string(interval) + "' for option '" +
+                                    key + "' in section '" + CFG_FORWARDER +
+                                    "' (must be zero or a power of two)"));
+      }
+      config.latencySamplingInterval = interval;
+    }
     else {
       NDN_THROW(ConfigFile::Error("Unrecognized option " + CFG_FORWARDER + "." + key));
     }
@@ -627,6 +794,8 @@ Forwarder::processConfig(const ConfigSection& configSection, bool isDryRun, cons
 
   if (!isDryRun) {
     m_config = config;
+    m_deadNonceList.setStorage(m_config.deadNonceListStorage);
+    LatencySampler::setInterval(m_config.latencySamplingInterval);
   }
 }
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -28,6 +28,7 @@
 
 #include "face-table.hpp"
 #include "forwarder-counters.hpp"
+#include "forwarder-latency.hpp"
 #include "unsolicited-data-policy.hpp"
 #include "common/config-file.hpp"
 #include "face/face-endpoint.hpp"
@@ -67,6 +68,12 @@ public:
     return m_counters;
   }
 
+  const ForwarderLatency&
+  getLatency() const noexcept
+  {
+    return m_latency;
+  }
+
   fw::UnsolicitedDataPolicy&
   getUnsolicitedDataPolicy() const noexcept
   {
@@ -80,6 +87,12 @@ public:
     m_unsolicitedDataPolicy = std::move(policy);
   }
 
+  FaceTable&
+  getFaceTable() noexcept
+  {
+    return m_faceTable;
+  }
+
   NameTree&
   getNameTree() noexcept
   {
@@ -134,6 +147,11 @@ public:
   setConfigFile(ConfigFile& configFile);
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
+  /** \brief Dispatches a burst of packets received on \p face to the incoming pipelines, in order.
+   */
+  void
+  onIncomingBatch(Face& face, span<const face::ReceivedPacket> packets);
+
   /** \brief Incoming Interest pipeline.
    *  \param interest the incoming Interest, must be well-formed and created with make_shared
    *  \param ingress face on which \p interest was received and endpoint of the sender
@@ -214,6 +232,12 @@ private:
   void
   setExpiryTimer(const shared_ptr<pit::Entry>& pitEntry, time::milliseconds duration);
 
+  /** \brief Set the expiry timer on a PIT entry to the time that its last in-record expires.
+   *  \pre \p pitEntry has at least one in-record
+   */
+  void
+  setExpiryTimerToLastInRecord(const shared_ptr<pit::Entry>& pitEntry);
+
   /** \brief Insert Nonce to Dead Nonce List if necessary.
    *  \param upstream if null, insert Nonces from all out-records;
    *                  if not null, insert Nonce only on the out-records of this face
@@ -221,6 +245,13 @@ private:
   void
   insertDeadNonceList(pit::Entry& pitEntry, const Face* upstream);
 
+  /** \brief Determine whether a CS lookup that completed after Cs::find returned can enter the
+   *         CS hit or miss pipeline, i.e., whether its PIT entry and ingress face still exist.
+   */
+  bool
+  canResumeAfterCsLookup(const Interest& interest, FaceId ingressFaceId,
+                         const shared_ptr<pit::Entry>& pitEntry);
+
   void
   processConfig(const ConfigSection& configSection, bool isDryRun,
                 const std::string& filename);
@@ -234,11 +265,17 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     /// Initial value of HopLimit that should be added to Interests that don't have one.
     /// A value of zero disables the feature.
     uint8_t defaultHopLimit = 0;
+    /// How the Dead Nonce List stores its entries.
+    DeadNonceListStorage deadNonceListStorage = DeadNonceListStorage::EXACT;
+    /// One in how many packets each pipeline stage and face measures; zero disables measuring.
+    uint32_t latencySamplingInterval = LatencySampler::DEFAULT_INTERVAL;
   };
   Config m_config;
 
 private:
   ForwarderCounters m_counters;
+  ForwarderLatency m_latency;
+  bool m_isInCsLookup = false; ///< whether Cs::find is on the call stack
 
   FaceTable& m_faceTable;
   unique_ptr<fw::UnsolicitedDataPolicy> m_unsolicitedDataPolicy;
@@ -252,6 +289,10 @@ private:
   DeadNonceList      m_deadNonceList;
   NetworkRegionTable m_networkRegionTable;
 
+  /// Drives the PIT entry expiry timers. Declared after the tables so that it is destroyed
+  /// first, releasing the PIT entries held by pending timers while the tables still exist.
+  TimerWheel         m_pitExpiryWheel;
+
   // allow Strategy (base class) to enter pipelines
   friend ::nfd::fw::Strategy;
 };
@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NFD_DAEMON_MGMT_DATASET_CHANGE_LOG_HPP
+#define NFD_DAEMON_MGMT_DATASET_CHANGE_LOG_HPP
+
+#include "core/common.hpp"
+#include "core/dataset-delta.hpp"
+
+#include <ndn-cxx/util/random.hpp>
+
+#include <map>
+
+namespace nfd {
+
+/**
+ * \brief Records which items of a dataset changed at which version, for serving delta datasets.
+ *
+ * Every change bumps the dataset version. Versions are only meaningful within the epoch of the
+ * log, a random number chosen when the log is created, i.e., when NFD starts.
+ *
+ * Only the latest change of each key is kept, so a delta lists each changed key once, and the
+ * caller looks up the current state of the key to tell an added or changed item from a removed
+ * one.
+ *
+ * The log keeps at most \p capacity keys. When it is full, the oldest change is dropped and
+ * clients that have not seen it must fetch a full snapshot instead.
+ *
+ * \tparam Key type of the dataset key, e.g., Name or FaceId
+ * \sa DatasetDeltaHeader
+ */
+template<typename Key>
+class DatasetChangeLog : noncopyable
+{
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 65536;
+
+  explicit
+  DatasetChangeLog(size_t capacity = DEFAULT_CAPACITY)
+    : m_capacity(capacity)
+    , m_epoch(ndn::random::generateWord64())
+  {
+    BOOST_ASSERT(m_capacity > 0);
+  }
+
+  /**
+   * \brief Returns the epoch, which distinguishes this log from those of other NFD instances.
+   */
+  uint64_t
+  getEpoch() const noexcept
+  {
+    return m_epoch;
+  }
+
+  /**
+   * \brief Returns the current dataset version.
+   *
+   * The initial version is 1, which represents the dataset state when the log was created.
+   */
+  uint64_t
+  getVersion() const noexcept
+  {
+    return m_version;
+  }
+
+  /**
+   * \brief Records that the item identified by \p key was added, changed, or removed.
+   */
+  void
+  markChanged(const Key& key)
+  {
+    ++m_version;
+    auto [it, isNew] = m_versionByKey.try_emplace(key, m_version);
+    if (!isNew) {
+      m_keyByVersion.erase(it->second);
+      it->second = m_version;
+    }
+    m_keyByVersion.emplace(m_version, key);
+
+    if (m_keyByVersion.size() > m_capacity) {
+      auto oldest = m_keyByVersion.begin();
+      m_minVersion = oldest->first;
+      m_versionByKey.erase(oldest->second);
+      m_keyByVersion.erase(oldest);
+    }
+  }
+
+  /**
+   * \brief Returns whether every change after \p since is still in the log.
+   *
+   * This is false if \p since belongs to another epoch, e.g., because the client saw it
+   * before a restart, or if its version is older than the oldest retained change or newer
+   * than the current version.
+   */
+  bool
+  canReportSince(const DatasetPosition& since) const noexcept
+  {
+    return since.epoch == m_epoch && since.version >= m_minVersion && since.version <= m_version;
+  }
+
+  /**
+   * \brief Invokes \p f with the key of each item that changed after \p since, oldest first.
+   * \pre canReportSince(since)
+   */
+  template<typename F>
+  void
+  forEachChangeSince(const DatasetPosition& since, F&& f) const
+  {
+    BOOST_ASSERT(canReportSince(since));
+    for (auto it = m_keyByVersion.upper_bound(since.version); it != m_keyByVersion.end(); ++it) {
+      f(it->second);
+    }
+  }
+
+private:
+  size_t m_capacity;
+  uint64_t m_epoch;
+  uint64_t m_version = 1;
+  uint64_t m_minVersion = 1;
+  std::map<Key, uint64_t> m_versionByKey;
+  std::map<uint64_t, Key> m_keyByVersion;
+};
+
+/**
+ * \brief Extracts the client's last seen epoch and version from a delta dataset request.
+ * \param datasetPrefix the dataset prefix, e.g., `/localhost/nfd/fib/changes`
+ * \param interestName the name of the request
+ * \return the position; zero epoch and version if the request does not carry them;
+ *         nullopt if it is malformed
+ */
+inline std::optional<DatasetPosition>
+extractDatasetPosition(const Name& datasetPrefix, const Name& interestName)
+{
+  if (interestName.size() <= datasetPrefix.size()) {
+    return DatasetPosition{};
+  }
+  if (interestName.size() < datasetPrefix.size() + 2) {
+    return std::nullopt;
+  }
+  const auto& epoch = interestName[datasetPrefix.size()];
+  const auto& version = interestName[datasetPrefix.size() + 1];
+  if (!epoch.isNumber() || !version.isNumber()) {
+    return std::nullopt;
+  }
+  return DatasetPosition{epoch.toNumber(), version.toNumber()};
+}
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_MGMT_DATASET_CHANGE_LOG_HPP
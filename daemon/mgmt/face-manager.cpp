@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,6 +26,7 @@
 #include "face-manager.hpp"
 
 #include "common/logger.hpp"
+#include "core/dataset-delta.hpp"
 #include "face/generic-link-service.hpp"
 #include "face/protocol-factory.hpp"
 #include "fw/face-table.hpp"
@@ -66,6 +67,8 @@ FaceManager::FaceManager(FaceSystem& faceSystem,
     [this] (auto&&, auto&&, auto&&... args) { listChannels(std::forward<decltype(args)>(args)...); });
   registerStatusDatasetHandler("query",
     [this] (auto&&, auto&&... args) { queryFaces(std::forward<decltype(args)>(args)...); });
+  registerStatusDatasetHandler("changes",
+    [this] (auto&&... args) { listChanges(std::forward<decltype(args)>(args)...); });
 
   // register notification stream
   m_postNotification = registerNotificationStream("events");
@@ -75,6 +78,8 @@ FaceManager::FaceManager(FaceSystem& faceSystem,
   });
   m_faceRemoveConn = m_faceTable.beforeRemove.connect([this] (const Face& face) {
     notifyFaceEvent(face, ndn::nfd::FACE_EVENT_DESTROYED);
+    m_faceFingerprints.erase(face.getId());
+    m_changeLog.markChanged(face.getId());
   });
 }
 
@@ -331,6 +336,7 @@ FaceManager::updateFace(const Interest& interest,
     face->setPersistency(parameters.getFacePersistency());
   }
   updateLinkServiceOptions(*face, parameters);
+  m_changeLog.markChanged(faceId);
 
   // Prepare and send ControlResponse
   response = makeUpdateFaceResponse(*face);
@@ -493,6 +499,56 @@ FaceManager::queryFaces(const Interest& interest,
   context.end();
 }
 
+void
+FaceManager::listChanges(const Name& topPrefix, const Interest& interest,
+                         ndn::mgmt::StatusDatasetContext& context)
+{
+  auto since = extractDatasetPosition(Name(topPrefix).append(getModule()).append("changes"),
+                                      interest.getName());
+  if (!since) {
+    NFD_LOG_DEBUG("Malformed dataset epoch or version: " << interest.getName());
+    return context.reject(ControlResponse(400, "Malformed epoch or version"));
+  }
+
+  detectFaceChanges();
+  auto now = time::steady_clock::now();
+  DatasetDeltaHeader header{m_changeLog.getEpoch(), m_changeLog.getVersion(),
+                            !m_changeLog.canReportSince(*since)};
+  context.append(header.wireEncode());
+
+  if (header.isFullSnapshot) {
+    for (const auto& face : m_faceTable) {
+      context.append(makeFaceStatus(face, now).wireEncode());
+    }
+  }
+  else {
+    m_changeLog.forEachChangeSince(*since, [&] (FaceId faceId) {
+      const Face* face = m_faceTable.get(faceId);
+      if (face != nullptr) {
+        context.append(makeFaceStatus(*face, now).wireEncode());
+      }
+      else {
+        context.append(DatasetRemoval{uint64_t{faceId}}.wireEncode());
+      }
+    });
+  }
+  context.end();
+}
+
+void
+FaceManager::detectFaceChanges()
+{
+  for (const auto& face : m_faceTable) {
+    FaceFingerprint fingerprint{face.getPersistency(), face.getMtu()};
+
+    auto [it, isNew] = m_faceFingerprints.try_emplace(face.getId(), fingerprint);
+    if (isNew || it->second != fingerprint) {
+      it->second = fingerprint;
+      m_changeLog.markChanged(face.getId());
+    }
+  }
+}
+
 void
 FaceManager::notifyFaceEvent(const Face& face, ndn::nfd::FaceEventKind kind)
 {
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_MGMT_FACE_MANAGER_HPP
 
 #include "manager-base.hpp"
+#include "dataset-change-log.hpp"
 #include "face/face.hpp"
 #include "face/face-system.hpp"
 
@@ -74,6 +75,30 @@ private: // StatusDataset
   void
   queryFaces(const Interest& interest, ndn::mgmt::StatusDatasetContext& context);
 
+  /**
+   * @brief Serve `faces/changes` dataset, the changes of `faces/list` since a given version.
+   *
+   * A face is reported when it is created, destroyed, or updated, and when its persistency
+   * or MTU differs from the previous request. Changes of counters or ExpirationPeriod alone
+   * are not reported, because they change continuously on busy faces: a reported FaceStatus
+   * carries the current counters, but clients monitoring counters should use `faces/list`
+   * or `faces/query`.
+   *
+   * @sa DatasetDeltaHeader
+   */
+  void
+  listChanges(const Name& topPrefix, const Interest& interest,
+              ndn::mgmt::StatusDatasetContext& context);
+
+  /**
+   * @brief Marks the faces whose persistency or MTU changed since the previous call.
+   *
+   * The MTU of some transports changes without a signal, so these properties are compared
+   * when a delta is requested.
+   */
+  void
+  detectFaceChanges();
+
 private: // NotificationStream
   void
   notifyFaceEvent(const Face& face, ndn::nfd::FaceEventKind kind);
@@ -90,6 +115,12 @@ private:
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   std::map<FaceId, signal::ScopedConnection> m_faceStateChangeConn;
+  DatasetChangeLog<FaceId> m_changeLog;
+
+private:
+  /// The persistency and MTU of a face, as of the last detectFaceChanges() call.
+  using FaceFingerprint = std::pair<ndn::nfd::FacePersistency, ssize_t>;
+  std::map<FaceId, FaceFingerprint> m_faceFingerprints;
 };
 
 } // namespace nfd
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,6 +26,7 @@
 #include "fib-manager.hpp"
 
 #include "common/logger.hpp"
+#include "core/dataset-delta.hpp"
 #include "fw/face-table.hpp"
 #include "table/fib.hpp"
 
@@ -53,6 +54,13 @@ FibManager::FibManager(Fib& fib, const FaceTable& faceTable,
   registerStatusDatasetHandler("list", [this] (auto&&, auto&&, auto&&... args) {
     listEntries(std::forward<decltype(args)>(args)...);
   });
+  registerStatusDatasetHandler("changes", [this] (auto&&... args) {
+    listChanges(std::forward<decltype(args)>(args)...);
+  });
+
+  m_fibChangeConn = m_fib.afterEntryChange.connect([this] (const Name& prefix) {
+    m_changeLog.markChanged(prefix);
+  });
 }
 
 void
@@ -125,20 +133,61 @@ void
 FibManager::listEntries(ndn::mgmt::StatusDatasetContext& context)
 {
   for (const auto& entry : m_fib) {
-    const auto& nexthops = entry.getNextHops() |
-                           boost::adaptors::transformed([] (const fib::NextHop& nh) {
-                             return ndn::nfd::NextHopRecord()
-                                 .setFaceId(nh.getFace().getId())
-                                 .setCost(nh.getCost());
-                           });
-    context.append(ndn::nfd::FibEntry()
-                   .setPrefix(entry.getPrefix())
-                   .setNextHopRecords(std::begin(nexthops), std::end(nexthops))
-                   .wireEncode());
+    context.append(encodeEntry(entry));
+  }
+  context.end();
+}
+
+void
+FibManager::listChanges(const Name& topPrefix, const Interest& interest,
+                        ndn::mgmt::StatusDatasetContext& context)
+{
+  auto since = extractDatasetPosition(Name(topPrefix).append(getModule()).append("changes"),
+                                      interest.getName());
+  if (!since) {
+    NFD_LOG_DEBUG("Malformed dataset epoch or version: " << interest.getName());
+    return context.reject(ControlResponse(400, "Malformed epoch or version"));
+  }
+
+  DatasetDeltaHeader header{m_changeLog.getEpoch(), m_changeLog.getVersion(),
+                            !m_changeLog.canReportSince(*since)};
+  context.append(header.wireEncode());
+
+  // only the entries in the response are encoded, so that polling an unchanged FIB is cheap
+  if (header.isFullSnapshot) {
+    for (const auto& entry : m_fib) {
+      context.append(encodeEntry(entry));
+    }
+  }
+  else {
+    m_changeLog.forEachChangeSince(*since, [&] (const Name& prefix) {
+      const fib::Entry* entry = m_fib.findExactMatch(prefix);
+      if (entry != nullptr) {
+        context.append(encodeEntry(*entry));
+      }
+      else {
+        context.append(DatasetRemoval{prefix}.wireEncode());
+      }
+    });
   }
   context.end();
 }
 
+Block
+FibManager::encodeEntry(const fib::Entry& entry)
+{
+  const auto& nexthops = entry.getNextHops() |
+                         boost::adaptors::transformed([] (const fib::NextHop& nh) {
+                           return ndn::nfd::NextHopRecord()
+                               .setFaceId(nh.getFace().getId())
+                               .setCost(nh.getCost());
+                         });
+  return ndn::nfd::FibEntry()
+         .setPrefix(entry.getPrefix())
+         .setNextHopRecords(std::begin(nexthops), std::end(nexthops))
+         .wireEncode();
+}
+
 void
 FibManager::setFaceForSelfRegistration(const Interest& request, ControlParameters& parameters)
 {
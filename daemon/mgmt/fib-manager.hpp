@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -27,10 +27,12 @@
 #define NFD_DAEMON_MGMT_FIB_MANAGER_HPP
 
 #include "manager-base.hpp"
+#include "dataset-change-log.hpp"
 
 namespace nfd {
 
 namespace fib {
+class Entry;
 class Fib;
 } // namespace fib
 
@@ -58,6 +60,18 @@ private:
   void
   listEntries(ndn::mgmt::StatusDatasetContext& context);
 
+  /**
+   * @brief Serve `fib/changes` dataset, the changes of `fib/list` since a given version.
+   * @sa DatasetDeltaHeader
+   */
+  void
+  listChanges(const Name& topPrefix, const Interest& interest,
+              ndn::mgmt::StatusDatasetContext& context);
+
+private:
+  static Block
+  encodeEntry(const fib::Entry& entry);
+
 private:
   void
   setFaceForSelfRegistration(const Interest& request, ControlParameters& parameters);
@@ -65,6 +79,12 @@ private:
 private:
   fib::Fib& m_fib;
   const FaceTable& m_faceTable;
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  DatasetChangeLog<Name> m_changeLog;
+
+private:
+  signal::ScopedConnection m_fibChangeConn;
 };
 
 } // namespace nfd
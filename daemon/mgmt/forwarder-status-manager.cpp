@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -25,8 +25,11 @@
 
 #include "forwarder-status-manager.hpp"
 #include "fw/forwarder.hpp"
+#include "core/latency-histogram.hpp"
 #include "core/version.hpp"
 
+#include <boost/lexical_cast.hpp>
+
 namespace nfd {
 
 ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher& dispatcher)
@@ -36,6 +39,8 @@ ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher&
 {
   m_dispatcher.addStatusDataset("status/general", ndn::mgmt::makeAcceptAllAuthorization(),
     [this] (auto&&, auto&&, auto&& ctx) { listGeneralStatus(std::forward<decltype(ctx)>(ctx)); });
+  m_dispatcher.addStatusDataset("status/latency", ndn::mgmt::makeAcceptAllAuthorization(),
+    [this] (auto&&, auto&&, auto&& ctx) { listLatency(std::forward<decltype(ctx)>(ctx)); });
 }
 
 ndn::nfd::ForwarderStatus
@@ -78,4 +83,28 @@ ForwarderStatusManager::listGeneralStatus(ndn::mgmt::StatusDatasetContext& conte
   context.end();
 }
 
+void
+ForwarderStatusManager::listLatency(ndn::mgmt::StatusDatasetContext& context)
+{
+  const auto& latency = m_forwarder.getLatency();
+  for (size_t i = 0; i < N_FORWARDER_STAGES; ++i) {
+    auto stage = static_cast<ForwarderStage>(i);
+    LatencyStatus item{boost::lexical_cast<std::string>(stage), std::nullopt,
+                       latency[stage].getHistogram()};
+    context.append(item.wireEncode());
+  }
+
+  for (const auto& face : m_forwarder.getFaceTable()) {
+    const auto* transport = face.getTransport();
+    if (transport->getRxLatency().getCount() > 0) {
+      context.append(LatencyStatus{"face-rx", face.getId(), transport->getRxLatency()}.wireEncode());
+    }
+    if (transport->getTxLatency().getCount() > 0) {
+      context.append(LatencyStatus{"face-tx", face.getId(), transport->getTxLatency()}.wireEncode());
+    }
+  }
+
+  context.end();
+}
+
 } // namespace nfd
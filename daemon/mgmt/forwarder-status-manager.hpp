@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -53,6 +53,15 @@ private:
   void
   listGeneralStatus(ndn::mgmt::StatusDatasetContext& context);
 
+  /**
+   * @brief Provides the latency dataset.
+   *
+   * The dataset contains one LatencyStatus for each forwarding pipeline stage, followed by
+   * the receive ("face-rx") and send ("face-tx") histograms of each face that has samples.
+   */
+  void
+  listLatency(ndn::mgmt::StatusDatasetContext& context);
+
 private:
   Forwarder& m_forwarder;
   Dispatcher& m_dispatcher;
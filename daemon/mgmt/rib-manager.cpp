@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -27,6 +27,7 @@
 
 #include "common/global.hpp"
 #include "common/logger.hpp"
+#include "core/dataset-delta.hpp"
 #include "rib/rib.hpp"
 #include "table/fib.hpp"
 
@@ -73,6 +74,18 @@ RibManager::RibManager(rib::Rib& rib, ndn::Face& face, ndn::KeyChain& keyChain,
   registerStatusDatasetHandler("list", [this] (auto&&, auto&&, auto&&... args) {
     listEntries(std::forward<decltype(args)>(args)...);
   });
+  registerStatusDatasetHandler("changes", [this] (auto&&... args) {
+    listChanges(std::forward<decltype(args)>(args)...);
+  });
+
+  // an entry is inserted by its first route and erased after its last route is removed,
+  // so watching the routes covers the entries as well
+  auto markChanged = [this] (const rib::RibRouteRef& ref) {
+    m_changeLog.markChanged(ref.entry->getName());
+  };
+  m_addRouteConn = m_rib.afterAddRoute.connect(markChanged);
+  m_updateRouteConn = m_rib.afterUpdateRoute.connect(markChanged);
+  m_removeRouteConn = m_rib.beforeRemoveRoute.connect(markChanged);
 }
 
 void
@@ -146,11 +159,10 @@ RibManager::addRoute(const Name& name, Route route, const time::steady_clock::ti
                " origin=" << route.origin << " cost=" << route.cost);
 
   if (route.expires) {
-    auto delay = *route.expires - now;
-    auto event = getScheduler().schedule(delay, [=] { m_rib.onRouteExpiration(name, route); });
-    route.setExpirationEvent(std::move(event));
+    // the RIB schedules the expiration once the route is inserted;
     // cast to milliseconds to make the logs easier to read
-    NFD_LOG_TRACE("Route will expire in " << time::duration_cast<time::milliseconds>(delay));
+    NFD_LOG_TRACE("Route will expire in " <<
+                  time::duration_cast<time::milliseconds>(*route.expires - now));
   }
 
   beginRibUpdate({rib::RibUpdate::REGISTER, name, std::move(route)}, done);
@@ -311,26 +323,68 @@ RibManager::announceEntry(const Interest& interest, const ndn::nfd::RibAnnounceP
     });
 }
 
+static Block
+encodeRibEntry(const rib::RibEntry& entry, const time::steady_clock::time_point& now)
+{
+  ndn::nfd::RibEntry item;
+  item.setName(entry.getName());
+  for (const Route& route : entry.getRoutes()) {
+    ndn::nfd::Route r;
+    r.setFaceId(route.faceId);
+    r.setOrigin(route.origin);
+    r.setCost(route.cost);
+    r.setFlags(route.flags);
+    if (route.expires) {
+      r.setExpirationPeriod(time::duration_cast<time::milliseconds>(*route.expires - now));
+    }
+    item.addRoute(r);
+  }
+  return item.wireEncode();
+}
+
 void
 RibManager::listEntries(ndn::mgmt::StatusDatasetContext& context) const
 {
   auto now = time::steady_clock::now();
   for (const auto& kv : m_rib) {
-    const rib::RibEntry& entry = *kv.second;
-    ndn::nfd::RibEntry item;
-    item.setName(entry.getName());
-    for (const Route& route : entry.getRoutes()) {
-      ndn::nfd::Route r;
-      r.setFaceId(route.faceId);
-      r.setOrigin(route.origin);
-      r.setCost(route.cost);
-      r.setFlags(route.flags);
-      if (route.expires) {
-        r.setExpirationPeriod(time::duration_cast<time::milliseconds>(*route.expires - now));
-      }
-      item.addRoute(r);
+    context.append(encodeRibEntry(*kv.second, now));
+  }
+  context.end();
+}
+
+void
+RibManager::listChanges(const Name& topPrefix, const Interest& interest,
+                        ndn::mgmt::StatusDatasetContext& context) const
+{
+  auto since = extractDatasetPosition(Name(topPrefix).append(getModule()).append("changes"),
+                                      interest.getName());
+  if (!since) {
+    NFD_LOG_DEBUG("Malformed dataset epoch or version: " << interest.getName());
+    return context.reject(ControlResponse(400, "Malformed epoch or version"));
+  }
+
+  // entries are encoded on every request, because the ExpirationPeriod of each route
+  // depends on the time of the request
+  auto now = time::steady_clock::now();
+  DatasetDeltaHeader header{m_changeLog.getEpoch(), m_changeLog.getVersion(),
+                            !m_changeLog.canReportSince(*since)};
+  context.append(header.wireEncode());
+
+  if (header.isFullSnapshot) {
+    for (const auto& kv : m_rib) {
+      context.append(encodeRibEntry(*kv.second, now));
     }
-    context.append(item.wireEncode());
+  }
+  else {
+    m_changeLog.forEachChangeSince(*since, [&] (const Name& prefix) {
+      auto it = m_rib.find(prefix);
+      if (it != m_rib.end()) {
+        context.append(encodeRibEntry(*it->second, now));
+      }
+      else {
+        context.append(DatasetRemoval{prefix}.wireEncode());
+      }
+    });
   }
   context.end();
 }
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_MGMT_RIB_MANAGER_HPP
 
 #include "manager-base.hpp"
+#include "dataset-change-log.hpp"
 
 #include <ndn-cxx/mgmt/nfd/controller.hpp>
 #include <ndn-cxx/mgmt/nfd/face-event-notification.hpp>
@@ -212,6 +213,14 @@ private: // management Dispatcher related
   void
   listEntries(ndn::mgmt::StatusDatasetContext& context) const;
 
+  /**
+   * \brief Serve `rib/changes` dataset, the changes of `rib/list` since a given version.
+   * \sa DatasetDeltaHeader
+   */
+  void
+  listChanges(const Name& topPrefix, const Interest& interest,
+              ndn::mgmt::StatusDatasetContext& context) const;
+
   ndn::mgmt::Authorization
   makeAuthorization(const std::string& verb) final;
 
@@ -245,6 +254,11 @@ private:
   bool m_isLocalhopEnabled;
 
   ndn::scheduler::ScopedEventId m_activeFaceFetchEvent;
+
+  DatasetChangeLog<Name> m_changeLog;
+  signal::ScopedConnection m_addRouteConn;
+  signal::ScopedConnection m_updateRouteConn;
+  signal::ScopedConnection m_removeRouteConn;
 };
 
 std::ostream&
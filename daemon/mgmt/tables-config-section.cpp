@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,11 +26,14 @@
 #include "tables-config-section.hpp"
 #include "fw/strategy.hpp"
 
+#include <limits>
 #include <map>
 
 namespace nfd {
 
 constexpr size_t DEFAULT_CS_MAX_PACKETS = 65536;
+constexpr size_t DEFAULT_CS_MAX_BYTES = std::numeric_limits<size_t>::max();
+constexpr uint64_t DEFAULT_CS_DISK_MAX_BYTES = uint64_t(1) << 30;
 
 TablesConfigSection::TablesConfigSection(Forwarder& forwarder)
   : m_forwarder(forwarder)
@@ -54,6 +57,8 @@ TablesConfigSection::ensureConfigured()
   }
 
   m_forwarder.getCs().setLimit(DEFAULT_CS_MAX_PACKETS);
+  m_forwarder.getCs().setByteLimit(DEFAULT_CS_MAX_BYTES);
+  m_forwarder.getCs().setDiskStore(nullptr);
   // Don't set default cs_policy because it's already created by CS itself.
   m_forwarder.setUnsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>());
 
@@ -69,6 +74,27 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun,
     nCsMaxPackets = ConfigFile::parseNumber<size_t>(*csMaxPacketsNode, "cs_max_packets", "tables");
   }
 
+  size_t nCsMaxBytes = DEFAULT_CS_MAX_BYTES;
+  OptionalConfigSection csMaxBytesNode = section.get_child_optional("cs_max_bytes");
+  if (csMaxBytesNode) {
+    nCsMaxBytes = ConfigFile::parseNumber<size_t>(*csMaxBytesNode, "cs_max_bytes", "tables");
+  }
+
+  std::string csDiskPath;
+  OptionalConfigSection csDiskPathNode = section.get_child_optional("cs_disk_path");
+  if (csDiskPathNode) {
+    csDiskPath = csDiskPathNode->get_value<std::string>();
+    if (csDiskPath.empty()) {
+      NDN_THROW(ConfigFile::Error("Invalid value for option 'cs_disk_path' in section 'tables'"));
+    }
+  }
+
+  uint64_t nCsDiskMaxBytes = DEFAULT_CS_DISK_MAX_BYTES;
+  OptionalConfigSection csDiskMaxBytesNode = section.get_child_optional("cs_disk_max_bytes");
+  if (csDiskMaxBytesNode) {
+    nCsDiskMaxBytes = ConfigFile::parseNumber<uint64_t>(*csDiskMaxBytesNode, "cs_disk_max_bytes", "tables");
+  }
+
   unique_ptr<cs::Policy> csPolicy;
   OptionalConfigSection csPolicyNode = section.get_child_optional("cs_policy");
   if (csPolicyNode) {
@@ -92,6 +118,29 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun,
     unsolicitedDataPolicy = make_unique<fw::DefaultUnsolicitedDataPolicy>();
   }
 
+  // the disk tier is checked (dry-run) or opened before any table is modified, so that an
+  // unusable cs_disk_path rejects the configuration as a whole
+  unique_ptr<cs::DiskStore> newDiskStore;
+  const cs::DiskStore* diskStore = m_forwarder.getCs().getDiskStore();
+  bool isDiskStoreUnchanged = diskStore != nullptr && diskStore->getPath() == csDiskPath &&
+                              diskStore->getMaxBytes() == nCsDiskMaxBytes;
+  if (!csDiskPath.empty() && !isDiskStoreUnchanged) {
+    try {
+      if (isDryRun) {
+        cs::DiskStore::checkPath(csDiskPath);
+      }
+      else {
+        // the old DiskStore must be closed first in case the new one uses the same file
+        m_forwarder.getCs().setDiskStore(nullptr);
+        newDiskStore = make_unique<cs::DiskStore>(csDiskPath, nCsDiskMaxBytes);
+      }
+    }
+    catch (const cs::DiskStore::Error& e) {
+      NDN_THROW_NESTED(ConfigFile::Error("Cannot open cs_disk_path '" + csDiskPath +
+                                         "' in section 'tables': " + e.what()));
+    }
+  }
+
   OptionalConfigSection strategyChoiceSection = section.get_child_optional("strategy_choice");
   if (strategyChoiceSection) {
     processStrategyChoiceSection(*strategyChoiceSection, isDryRun);
@@ -107,7 +156,15 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun,
   }
 
   Cs& cs = m_forwarder.getCs();
+  if (csDiskPath.empty()) {
+    cs.setDiskStore(nullptr);
+  }
+  else if (newDiskStore != nullptr) {
+    cs.setDiskStore(std::move(newDiskStore));
+  }
+
   cs.setLimit(nCsMaxPackets);
+  cs.setByteLimit(nCsMaxBytes);
   if (cs.size() == 0 && csPolicy != nullptr) {
     cs.setPolicy(std::move(csPolicy));
   }
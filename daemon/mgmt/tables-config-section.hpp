@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -38,6 +38,9 @@ namespace nfd {
  *  tables
  *  {
  *    cs_max_packets 65536
+ *    cs_max_bytes 536870912
+ *    cs_disk_path /var/cache/ndn/nfd-cs.log
+ *    cs_disk_max_bytes 1073741824
  *    cs_policy lru
  *    cs_unsolicited_policy drop-all
  *
@@ -58,8 +61,11 @@ namespace nfd {
  *  \endcode
  *
  *  During a configuration reload,
- *  \li cs_max_packets, cs_policy, and cs_unsolicited_policy are applied;
+ *  \li cs_max_packets, cs_max_bytes, cs_policy, and cs_unsolicited_policy are applied;
  *      defaults are used if an option is omitted.
+ *  \li the disk tier of the Content Store is enabled if cs_disk_path is present, otherwise it is
+ *      disabled; it is recreated, discarding its contents, only if cs_disk_path or
+ *      cs_disk_max_bytes has changed.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
  *
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -51,6 +51,10 @@ class Face;
 class FaceSystem;
 } // namespace face
 
+namespace rib {
+class FibUpdateChannel;
+} // namespace rib
+
 /**
  * \brief Class representing the NFD instance.
  *
@@ -123,6 +127,7 @@ private:
   unique_ptr<ForwarderStatusManager> m_forwarderStatusManager;
   unique_ptr<FaceManager> m_faceManager;
   unique_ptr<FibManager> m_fibManager;
+  unique_ptr<rib::FibUpdateChannel> m_fibUpdateChannel;
   unique_ptr<CsManager> m_csManager;
   unique_ptr<StrategyChoiceManager> m_strategyChoiceManager;
 
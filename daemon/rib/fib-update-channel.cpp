@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fib-update-channel.hpp"
+
+#include "common/global.hpp"
+#include "common/logger.hpp"
+#include "fw/face-table.hpp"
+#include "table/fib.hpp"
+
+#include <boost/asio/post.hpp>
+
+namespace nfd::rib {
+
+NFD_LOG_INIT(FibUpdateChannel);
+
+FibUpdateChannel::FibUpdateChannel(fib::Fib& fib, const FaceTable& faceTable)
+  : m_fib(fib)
+  , m_faceTable(faceTable)
+{
+  if (s_instance != nullptr) {
+    NDN_THROW(std::logic_error("FibUpdateChannel cannot be instantiated more than once"));
+  }
+  s_instance = this;
+}
+
+FibUpdateChannel::~FibUpdateChannel()
+{
+  s_instance = nullptr;
+}
+
+void
+FibUpdateChannel::send(FibUpdateList updates, ResponseCallback onResponse)
+{
+  boost::asio::post(getMainIoService(),
+    [this, updates = std::move(updates), onResponse = std::move(onResponse)] () mutable {
+      auto responses = apply(updates);
+      boost::asio::post(getRibIoService(),
+        [updates = std::move(updates), responses = std::move(responses),
+         onResponse = std::move(onResponse)] {
+          onResponse(updates, responses);
+        });
+    });
+}
+
+FibUpdateChannel::ResponseList
+FibUpdateChannel::apply(const FibUpdateList& updates)
+{
+  ResponseList responses;
+  responses.reserve(updates.size());
+
+  for (const auto& update : updates) {
+    switch (update.action) {
+      case FibUpdate::ADD_NEXTHOP:
+        responses.push_back(addNextHop(update));
+        break;
+      case FibUpdate::REMOVE_NEXTHOP:
+        responses.push_back(removeNextHop(update));
+        break;
+    }
+  }
+  return responses;
+}
+
+ndn::nfd::ControlResponse
+FibUpdateChannel::addNextHop(const FibUpdate& update)
+{
+  if (update.name.size() > fib::Fib::getMaxDepth()) {
+    NFD_LOG_DEBUG(update << " -> FAIL prefix-too-long");
+    return ndn::nfd::ControlResponse(414, "FIB entry prefix cannot exceed " +
+                                     std::to_string(fib::Fib::getMaxDepth()) + " components");
+  }
+
+  Face* face = m_faceTable.get(update.faceId);
+  if (face == nullptr) {
+    NFD_LOG_DEBUG(update << " -> FAIL unknown-faceid");
+    return ndn::nfd::ControlResponse(410, "Face not found");
+  }
+
+  fib::Entry* entry = m_fib.insert(update.name).first;
+  m_fib.addOrUpdateNextHop(*entry, *face, update.cost);
+
+  NFD_LOG_TRACE(update << " -> OK");
+  return ndn::nfd::ControlResponse(200, "OK");
+}
+
+ndn::nfd::ControlResponse
+FibUpdateChannel::removeNextHop(const FibUpdate& update)
+{
+  Face* face = m_faceTable.get(update.faceId);
+  if (face == nullptr) {
+    NFD_LOG_TRACE(update << " -> OK no-face");
+    return ndn::nfd::ControlResponse(200, "OK");
+  }
+
+  fib::Entry* entry = m_fib.findExactMatch(update.name);
+  if (entry == nullptr) {
+    NFD_LOG_TRACE(update << " -> OK no-entry");
+    return ndn::nfd::ControlResponse(200, "OK");
+  }
+
+  m_fib.removeNextHop(*entry, *face);
+  NFD_LOG_TRACE(update << " -> OK");
+  return ndn::nfd::ControlResponse(200, "OK");
+}
+
+} // namespace nfd::rib
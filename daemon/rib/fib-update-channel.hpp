@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_RIB_FIB_UPDATE_CHANNEL_HPP
+#define NFD_DAEMON_RIB_FIB_UPDATE_CHANNEL_HPP
+
+#include "core/common.hpp"
+#include "fib-update.hpp"
+
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
+
+namespace nfd {
+
+namespace fib {
+class Fib;
+} // namespace fib
+
+class FaceTable;
+
+namespace rib {
+
+/**
+ * \brief In-process channel through which NFD-RIB applies FIB updates to the forwarder.
+ *
+ * NFD-RIB runs in the same process as the forwarder, so FibUpdater does not need to sign a
+ * command Interest for every FIB update and have FibManager validate it. Instead, a batch of
+ * updates is handed over to the main thread in a single event, applied directly to the FIB,
+ * and the responses are handed back to the RIB thread in a single event.
+ *
+ * FibManager keeps serving the management protocol for external clients.
+ */
+class FibUpdateChannel : noncopyable
+{
+public:
+  using FibUpdateList = std::list<FibUpdate>;
+  using ResponseList = std::vector<ndn::nfd::ControlResponse>;
+  using ResponseCallback = std::function<void(const FibUpdateList& updates,
+                                              const ResponseList& responses)>;
+
+  /**
+   * \brief Create the channel and make it available through FibUpdateChannel::get().
+   * \pre Must be constructed on the main thread, before the RIB thread is started.
+   * \throw std::logic_error Instance of FibUpdateChannel has been already constructed
+   */
+  FibUpdateChannel(fib::Fib& fib, const FaceTable& faceTable);
+
+  ~FibUpdateChannel();
+
+  /**
+   * \brief Get the only instance of this class, or nullptr if none has been constructed.
+   *
+   * When NFD-RIB runs without a forwarder in the same process, no channel exists, and
+   * FIB updates are sent as management commands.
+   */
+  static FibUpdateChannel*
+  get() noexcept
+  {
+    return s_instance;
+  }
+
+  /**
+   * \brief Apply \p updates on the main thread.
+   *
+   * \p onResponse is invoked on the RIB thread with one response per update, in the same
+   * order as \p updates. The response codes are the same as FibManager would return.
+   *
+   * \warning Must be called from the RIB thread.
+   */
+  void
+  send(FibUpdateList updates, ResponseCallback onResponse);
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /**
+   * \brief Apply \p updates to the FIB.
+   * \return one response per update, in the same order as \p updates
+   * \warning Must be called from the main thread.
+   */
+  ResponseList
+  apply(const FibUpdateList& updates);
+
+private:
+  ndn::nfd::ControlResponse
+  addNextHop(const FibUpdate& update);
+
+  ndn::nfd::ControlResponse
+  removeNextHop(const FibUpdate& update);
+
+private:
+  static inline FibUpdateChannel* s_instance = nullptr;
+
+  fib::Fib& m_fib;
+  const FaceTable& m_faceTable;
+};
+
+} // namespace rib
+} // namespace nfd
+
+#endif // NFD_DAEMON_RIB_FIB_UPDATE_CHANNEL_HPP
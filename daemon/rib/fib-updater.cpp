@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -24,6 +24,7 @@
  */
 
 #include "fib-updater.hpp"
+#include "fib-update-channel.hpp"
 #include "common/logger.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-command.hpp>
@@ -35,9 +36,10 @@ NFD_LOG_INIT(FibUpdater);
 constexpr int MAX_NUM_TIMEOUTS = 10;
 constexpr uint32_t ERROR_FACE_NOT_FOUND = 410;
 
-FibUpdater::FibUpdater(Rib& rib, ndn::nfd::Controller& controller)
+FibUpdater::FibUpdater(Rib& rib, ndn::nfd::Controller& controller, FibUpdateChannel* channel)
   : m_rib(rib)
   , m_controller(controller)
+  , m_channel(channel)
 {
   rib.setFibUpdater(this);
 }
@@ -48,6 +50,8 @@ FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
                                      const FibUpdateFailureCallback& onFailure)
 {
   m_batchFaceId = batch.getFaceId();
+  // responses to updates of earlier batches are ignored from now on
+  ++m_generation;
 
   // Erase previously calculated inherited routes
   m_inheritedRoutes.clear();
@@ -116,19 +120,8 @@ FibUpdater::computeUpdatesForRegistration(const RibUpdate& update)
   }
   else {
     // New name in RIB
-    // Find prefix's parent
-    shared_ptr<RibEntry> parent = m_rib.findParent(update.name);
-
-    Rib::RibEntryList descendants = m_rib.findDescendantsForNonInsertedName(update.name);
-    Rib::RibEntryList children;
-
-    for (const auto& descendant : descendants) {
-      // If the child has the same parent as the new entry,
-      // the new entry must be the child's new parent
-      if (descendant->getParent() == parent) {
-        children.push_back(descendant);
-      }
-    }
+    // The new entry will become the parent of the topmost entries under its name
+    Rib::RibEntryList children = m_rib.findChildren(update.name);
 
     createFibUpdatesForNewRibEntry(update.name, update.route, children);
   }
@@ -177,6 +170,23 @@ FibUpdater::sendUpdates(const FibUpdateList& updates,
 {
   NFD_LOG_DEBUG("Applying " << updates.size() << " FIB update(s)");
 
+  if (m_channel != nullptr) {
+    m_channel->send(updates, [=, generation = m_generation] (const auto& sentUpdates,
+                                                             const auto& responses) {
+      auto response = responses.begin();
+      for (const FibUpdate& update : sentUpdates) {
+        if (response->getCode() == 200) {
+          onUpdateSuccess(update, generation, onSuccess, onFailure);
+        }
+        else {
+          onUpdateError(update, generation, onSuccess, onFailure, *response, 0);
+        }
+        ++response;
+      }
+    });
+    return;
+  }
+
   for (const FibUpdate& update : updates) {
     NFD_LOG_DEBUG("Sending " << update);
 
@@ -224,8 +234,12 @@ FibUpdater::sendAddNextHopUpdate(const FibUpdate& update,
       .setName(update.name)
       .setFaceId(update.faceId)
       .setCost(update.cost),
-    [=] (const auto&) { onUpdateSuccess(update, onSuccess, onFailure); },
-    [=] (const auto& resp) { onUpdateError(update, onSuccess, onFailure, resp, nTimeouts); });
+    [=, generation = m_generation] (const auto&) {
+      onUpdateSuccess(update, generation, onSuccess, onFailure);
+    },
+    [=, generation = m_generation] (const auto& resp) {
+      onUpdateError(update, generation, onSuccess, onFailure, resp, nTimeouts);
+    });
 }
 
 void
@@ -238,15 +252,24 @@ FibUpdater::sendRemoveNextHopUpdate(const FibUpdate& update,
     ControlParameters()
       .setName(update.name)
       .setFaceId(update.faceId),
-    [=] (const auto&) { onUpdateSuccess(update, onSuccess, onFailure); },
-    [=] (const auto& resp) { onUpdateError(update, onSuccess, onFailure, resp, nTimeouts); });
+    [=, generation = m_generation] (const auto&) {
+      onUpdateSuccess(update, generation, onSuccess, onFailure);
+    },
+    [=, generation = m_generation] (const auto& resp) {
+      onUpdateError(update, generation, onSuccess, onFailure, resp, nTimeouts);
+    });
 }
 
 void
-FibUpdater::onUpdateSuccess(const FibUpdate& update,
+FibUpdater::onUpdateSuccess(const FibUpdate& update, uint64_t generation,
                             const FibUpdateSuccessCallback& onSuccess,
                             const FibUpdateFailureCallback& onFailure)
 {
+  if (generation != m_generation) {
+    // response for a batch that has already failed
+    return;
+  }
+
   if (update.faceId == m_batchFaceId) {
     m_updatesForBatchFaceId.remove(update);
 
@@ -264,7 +287,7 @@ FibUpdater::onUpdateSuccess(const FibUpdate& update,
 }
 
 void
-FibUpdater::onUpdateError(const FibUpdate& update,
+FibUpdater::onUpdateError(const FibUpdate& update, uint64_t generation,
                           const FibUpdateSuccessCallback& onSuccess,
                           const FibUpdateFailureCallback& onFailure,
                           const ndn::nfd::ControlResponse& response, uint32_t nTimeouts)
@@ -273,11 +296,20 @@ FibUpdater::onUpdateError(const FibUpdate& update,
   NFD_LOG_DEBUG("Failed to apply " << update <<
                 " [code: " << code << ", error: " << response.getText() << "]");
 
+  if (generation != m_generation) {
+    // response for a batch that has already failed
+    return;
+  }
+
   if (code == ndn::nfd::Controller::ERROR_TIMEOUT && nTimeouts < MAX_NUM_TIMEOUTS) {
     sendAddNextHopUpdate(update, onSuccess, onFailure, ++nTimeouts);
   }
   else if (code == ERROR_FACE_NOT_FOUND) {
     if (update.faceId == m_batchFaceId) {
+      // the other updates of the batch will fail as well, ignore their responses
+      ++m_generation;
+      m_updatesForBatchFaceId.clear();
+      m_updatesForNonBatchFaceId.clear();
       onFailure(code, response.getText());
     }
     else {
@@ -620,6 +652,11 @@ FibUpdater::modifyChildrensInheritedRoutes(const Rib::RibEntryList& children,
                                            const Rib::RouteSet& routesToAdd,
                                            const Rib::RouteSet& routesToRemove)
 {
+  // Nothing changes in the subtrees, so there is no need to visit them
+  if (routesToAdd.empty() && routesToRemove.empty()) {
+    return;
+  }
+
   for (const auto& child : children) {
     traverseSubTree(*child, routesToAdd, routesToRemove);
   }
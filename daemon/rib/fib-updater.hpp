@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -35,8 +35,13 @@
 
 namespace nfd::rib {
 
+class FibUpdateChannel;
+
 /**
  * \brief Computes FibUpdates based on updates to the RIB and sends them to NFD.
+ *
+ * If a FibUpdateChannel is given to the constructor, FIB updates are applied directly to the
+ * forwarder's FIB through it. Otherwise, they are sent to NFD as FIB management commands.
  */
 class FibUpdater : noncopyable
 {
@@ -51,7 +56,7 @@ public:
   using FibUpdateSuccessCallback = std::function<void(RibUpdateList inheritedRoutes)>;
   using FibUpdateFailureCallback = std::function<void(uint32_t code, const std::string& error)>;
 
-  FibUpdater(Rib& rib, ndn::nfd::Controller& controller);
+  FibUpdater(Rib& rib, ndn::nfd::Controller& controller, FibUpdateChannel* channel = nullptr);
 
 #ifdef NFD_WITH_TESTS
   virtual
@@ -61,6 +66,11 @@ public:
   /** \brief Computes FibUpdates using the provided RibUpdateBatch and then sends the
    *         updates to NFD's FIB.
    *
+   *  All FIB updates for the batch's Face ID are sent at once, followed by all FIB updates for
+   *  other faces, so a batch takes two round trips to NFD regardless of its size.
+   *  The RIB updates in the batch must not have overlapping namespaces, because each of them
+   *  is computed against the RIB as it was before the batch.
+   *
    *  \note  Caller must guarantee that the previous batch has either succeeded or failed
    *         before calling this method
    */
@@ -80,6 +90,8 @@ private:
   /**
    * \brief Sends the passed updates to NFD.
    *
+   * If a FibUpdateChannel is available, all updates are handed over to it at once.
+   *
    * onSuccess or onFailure will be called based on the results in
    * onUpdateSuccess or onUpdateFailure.
    *
@@ -155,9 +167,11 @@ NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE:
    * If the update has a different Face ID than the batch being processed, the update is
    * removed from m_updatesForBatchNonFaceId. If m_updatesForBatchNonFaceId becomes empty,
    * the FIB update process is considered a success.
+   *
+   * The response is ignored if \p generation is not the current generation.
    */
   void
-  onUpdateSuccess(const FibUpdate& update,
+  onUpdateSuccess(const FibUpdate& update, uint64_t generation,
                   const FibUpdateSuccessCallback& onSuccess,
                   const FibUpdateFailureCallback& onFailure);
 
@@ -176,9 +190,11 @@ NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE:
    * ignored.
    *
    * Otherwise, a non-recoverable error has occurred and an exception is thrown.
+   *
+   * The response is ignored if \p generation is not the current generation.
    */
   void
-  onUpdateError(const FibUpdate& update,
+  onUpdateError(const FibUpdate& update, uint64_t generation,
                 const FibUpdateSuccessCallback& onSuccess,
                 const FibUpdateFailureCallback& onFailure,
                 const ndn::nfd::ControlResponse& response, uint32_t nTimeouts);
@@ -277,12 +293,21 @@ private:
 private:
   const Rib& m_rib;
   ndn::nfd::Controller& m_controller;
+  FibUpdateChannel* m_channel;
   uint64_t m_batchFaceId;
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   FibUpdateList m_updatesForBatchFaceId;
   FibUpdateList m_updatesForNonBatchFaceId;
 
+  /**
+   * \brief Generation of the batch being processed.
+   *
+   * Incremented when a batch starts and when it fails. Each update is sent with the current
+   * generation, and responses that carry an older one are ignored.
+   */
+  uint64_t m_generation = 0;
+
   /**
    * \brief List of inherited routes generated during FIB update calculation;
    *        passed to the RIB when updates are completed successfully.
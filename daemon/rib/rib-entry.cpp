@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -86,7 +86,8 @@ RibEntry::addChild(shared_ptr<RibEntry> child)
 {
   BOOST_ASSERT(!child->getParent());
   child->m_parent = shared_from_this();
-  m_children.push_back(std::move(child));
+  RibEntry& childRef = *child;
+  childRef.m_posInParent = m_children.insert(m_children.end(), std::move(child));
 }
 
 void
@@ -94,7 +95,7 @@ RibEntry::removeChild(shared_ptr<RibEntry> child)
 {
   BOOST_ASSERT(child->getParent().get() == this);
   child->m_parent = nullptr;
-  m_children.remove(child);
+  m_children.erase(child->m_posInParent);
 }
 
 RibEntry::RouteList::iterator
@@ -105,10 +106,6 @@ RibEntry::eraseRoute(RouteList::iterator route)
       m_nRoutesWithCaptureSet--;
     }
 
-    // Cancel any scheduled event
-    NFD_LOG_TRACE("Cancelling expiration event: " << route->getExpirationEvent());
-    route->cancelExpirationEvent();
-
     return m_routes.erase(route);
   }
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -223,6 +223,8 @@ private:
   Name m_name;
   std::list<shared_ptr<RibEntry>> m_children;
   shared_ptr<RibEntry> m_parent;
+  /// Position of this entry in the parent's children list, valid only if m_parent is set.
+  std::list<shared_ptr<RibEntry>>::iterator m_posInParent;
   RouteList m_routes;
   RouteList m_inheritedRoutes;
 
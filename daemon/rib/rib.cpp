@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -25,6 +25,7 @@
 
 #include "rib.hpp"
 #include "fib-updater.hpp"
+#include "common/global.hpp"
 #include "common/logger.hpp"
 
 namespace nfd::rib {
@@ -101,13 +102,9 @@ Rib::insert(const Name& prefix, const Route& route)
     }
     else {
       // Route exists, update fields
-      // First cancel old scheduled event, if any, then set the EventId to new one
-      if (entryIt->getExpirationEvent()) {
-        NFD_LOG_TRACE("Cancelling expiration event for " << entry->getName() << " " << *entryIt);
-        entryIt->cancelExpirationEvent();
-      }
-
       *entryIt = route;
+
+      afterUpdateRoute(RibRouteRef{entry, entryIt});
     }
   }
   else {
@@ -128,15 +125,13 @@ Rib::insert(const Name& prefix, const Route& route)
       parent->addChild(entry);
     }
 
-    auto children = findDescendants(prefix);
-    for (const auto& child : children) {
-      if (child->getParent() == parent) {
-        // Remove child from parent and inherit parent's child
-        if (parent != nullptr) {
-          parent->removeChild(child);
-        }
-        entry->addChild(child);
+    for (const auto& child : findChildren(prefix)) {
+      BOOST_ASSERT(child->getParent() == parent);
+      // Remove child from parent and inherit parent's child
+      if (parent != nullptr) {
+        parent->removeChild(child);
       }
+      entry->addChild(child);
     }
 
     // Register with face lookup table
@@ -146,6 +141,13 @@ Rib::insert(const Name& prefix, const Route& route)
     afterInsertEntry(prefix);
     afterAddRoute(RibRouteRef{entry, routeIt});
   }
+
+  if (route.expires) {
+    scheduleExpiration(prefix, route);
+  }
+  else {
+    cancelExpiration(prefix, route);
+  }
 }
 
 void
@@ -162,6 +164,7 @@ Rib::erase(const Name& prefix, const Route& route)
 
   if (routeIt != entry->end()) {
     beforeRemoveRoute(RibRouteRef{entry, routeIt});
+    cancelExpiration(prefix, route);
 
     auto faceId = route.faceId;
     entry->eraseRoute(routeIt);
@@ -192,6 +195,107 @@ Rib::onRouteExpiration(const Name& prefix, const Route& route)
   beginApplyUpdate({RibUpdate::UNREGISTER, prefix, route}, nullptr, nullptr);
 }
 
+void
+Rib::scheduleExpiration(const Name& prefix, const Route& route)
+{
+  BOOST_ASSERT(route.expires);
+
+  // round up, so that a route never expires before its expiration time
+  auto sinceEpoch = route.expires->time_since_epoch();
+  auto nIntervals = (sinceEpoch + ROUTE_EXPIRATION_GRANULARITY - 1_ns) / ROUTE_EXPIRATION_GRANULARITY;
+  time::steady_clock::time_point deadline(nIntervals * ROUTE_EXPIRATION_GRANULARITY);
+
+  auto [it, isNewRoute] = m_expiringRoutes.try_emplace({prefix, route.faceId, route.origin}, deadline);
+  if (!isNewRoute) {
+    if (it->second == deadline) {
+      return;
+    }
+    // renewed route, move it to the new bucket
+    auto oldBucket = m_expirationBuckets.find(it->second);
+    BOOST_ASSERT(oldBucket != m_expirationBuckets.end());
+    oldBucket->second.erase(it->first);
+    if (oldBucket->second.empty()) {
+      m_expirationBuckets.erase(oldBucket);
+    }
+    it->second = deadline;
+  }
+
+  auto [bucket, isNew] = m_expirationBuckets.try_emplace(deadline);
+  bucket->second.insert(it->first);
+
+  if (isNew && bucket == m_expirationBuckets.begin()) {
+    scheduleNextExpiration();
+  }
+}
+
+void
+Rib::cancelExpiration(const Name& prefix, const Route& route)
+{
+  auto it = m_expiringRoutes.find({prefix, route.faceId, route.origin});
+  if (it == m_expiringRoutes.end()) {
+    return;
+  }
+
+  // the event of an emptied earliest bucket is left pending, expireRoutes() then does nothing
+  auto bucket = m_expirationBuckets.find(it->second);
+  BOOST_ASSERT(bucket != m_expirationBuckets.end());
+  bucket->second.erase(it->first);
+  if (bucket->second.empty()) {
+    m_expirationBuckets.erase(bucket);
+  }
+  m_expiringRoutes.erase(it);
+}
+
+void
+Rib::scheduleNextExpiration()
+{
+  if (m_expirationBuckets.empty()) {
+    m_expirationEvent.cancel();
+    return;
+  }
+
+  auto delay = std::max(m_expirationBuckets.begin()->first - time::steady_clock::now(),
+                        time::steady_clock::duration::zero());
+  m_expirationEvent = getScheduler().schedule(delay, [this] { expireRoutes(); });
+}
+
+void
+Rib::expireRoutes()
+{
+  auto now = time::steady_clock::now();
+
+  std::vector<ExpiringRoute> due;
+  auto end = m_expirationBuckets.upper_bound(now);
+  for (auto it = m_expirationBuckets.begin(); it != end; ++it) {
+    for (const auto& item : it->second) {
+      m_expiringRoutes.erase(item);
+      due.push_back(item);
+    }
+  }
+  m_expirationBuckets.erase(m_expirationBuckets.begin(), end);
+
+  size_t nExpired = 0;
+  for (const auto& item : due) {
+    Route key;
+    key.faceId = item.faceId;
+    key.origin = item.origin;
+    const Route* route = find(item.prefix, key);
+
+    // every route is in the bucket of its current expiration time, this is only a safeguard
+    if (route == nullptr || !route->expires || *route->expires > now) {
+      continue;
+    }
+
+    NFD_LOG_DEBUG(*route << " for " << item.prefix << " has expired");
+    addUpdateToQueue({RibUpdate::UNREGISTER, item.prefix, *route}, nullptr, nullptr);
+    ++nExpired;
+  }
+  NFD_LOG_TRACE(nExpired << " of " << due.size() << " route(s) due for expiration have expired");
+
+  sendBatchFromQueue();
+  scheduleNextExpiration();
+}
+
 shared_ptr<RibEntry>
 Rib::findParent(const Name& prefix) const
 {
@@ -205,36 +309,16 @@ Rib::findParent(const Name& prefix) const
   return nullptr;
 }
 
-std::list<shared_ptr<RibEntry>>
-Rib::findDescendants(const Name& prefix) const
-{
-  std::list<shared_ptr<RibEntry>> children;
-
-  auto it = m_rib.find(prefix);
-  if (it != m_rib.end()) {
-    ++it;
-    for (; it != m_rib.end(); ++it) {
-      if (prefix.isPrefixOf(it->first)) {
-        children.push_back(it->second);
-      }
-      else {
-        break;
-      }
-    }
-  }
-
-  return children;
-}
-
-std::list<shared_ptr<RibEntry>>
-Rib::findDescendantsForNonInsertedName(const Name& prefix) const
+Rib::RibEntryList
+Rib::findChildren(const Name& prefix) const
 {
-  std::list<shared_ptr<RibEntry>> children;
+  RibEntryList children;
 
-  for (const auto& [name, ribEntry] : m_rib) {
-    if (prefix.isPrefixOf(name)) {
-      children.push_back(ribEntry);
-    }
+  auto it = m_rib.upper_bound(prefix);
+  while (it != m_rib.end() && prefix.isPrefixOf(it->first)) {
+    children.push_back(it->second);
+    // skip the descendants of this child, which sort before the successor of its name
+    it = m_rib.lower_bound(it->first.getSuccessor());
   }
 
   return children;
@@ -373,43 +457,83 @@ Rib::addUpdateToQueue(const RibUpdate& update,
                       const Rib::UpdateSuccessCallback& onSuccess,
                       const Rib::UpdateFailureCallback& onFailure)
 {
-  RibUpdateBatch batch(update.route.faceId);
-  batch.add(update);
+  m_updateQueue.push_back({update, onSuccess, onFailure});
+}
+
+/** \brief Determines whether \p name is equal to, a prefix of, or an extension of a name
+ *         in \p names.
+ */
+static bool
+isRelatedToAny(const std::set<Name>& names, const Name& name)
+{
+  for (size_t i = 0; i <= name.size(); ++i) {
+    if (names.count(name.getPrefix(i)) > 0) {
+      return true;
+    }
+  }
 
-  UpdateQueueItem item{batch, onSuccess, onFailure};
-  m_updateBatches.push_back(std::move(item));
+  auto it = names.lower_bound(name);
+  return it != names.end() && name.isPrefixOf(*it);
 }
 
 void
 Rib::sendBatchFromQueue()
 {
-  if (m_updateBatches.empty() || m_isUpdateInProgress) {
+  if (m_updateQueue.empty() || m_isUpdateInProgress) {
     return;
   }
 
   m_isUpdateInProgress = true;
 
-  UpdateQueueItem item = std::move(m_updateBatches.front());
-  m_updateBatches.pop_front();
+  // FibUpdater computes the FIB updates of a whole batch against the current RIB, so an update
+  // can join the batch only if its namespace does not overlap with that of another update in
+  // the batch. It can also be moved ahead of updates that stay in the queue only if it does
+  // not overlap with them either, so that overlapping updates are applied in order.
+  // REMOVE_FACE updates are not mixed with other actions, because FibUpdater discards all
+  // FIB updates for the face of a batch containing REMOVE_FACE.
+  const RibUpdate& first = m_updateQueue.front().update;
+  uint64_t faceId = first.route.faceId;
+  bool isRemoveFace = first.action == RibUpdate::REMOVE_FACE;
+
+  std::set<Name> seenNames;
+  size_t nExamined = 0;
+  for (auto it = m_updateQueue.begin();
+       it != m_updateQueue.end() && nExamined < MAX_UPDATE_BATCH_LOOKAHEAD &&
+       m_inProgressUpdates.size() < MAX_UPDATE_BATCH_SIZE;
+       ++nExamined) {
+    const RibUpdate& update = it->update;
+    bool canJoinBatch = update.route.faceId == faceId &&
+                        (update.action == RibUpdate::REMOVE_FACE) == isRemoveFace &&
+                        !isRelatedToAny(seenNames, update.name);
+    seenNames.insert(update.name);
+
+    auto next = std::next(it);
+    if (canJoinBatch) {
+      m_inProgressUpdates.splice(m_inProgressUpdates.end(), m_updateQueue, it);
+    }
+    it = next;
+  }
 
-  // Until task #1698, each RibUpdateBatch contains exactly one RIB update
-  BOOST_ASSERT(item.batch.size() == 1);
+  RibUpdateBatch batch(faceId);
+  for (const auto& item : m_inProgressUpdates) {
+    batch.add(item.update);
+  }
+  NFD_LOG_DEBUG("Applying batch of " << batch.size() << " update(s) for faceid=" << faceId
+                << ", " << m_updateQueue.size() << " update(s) remain queued");
 
-  m_fibUpdater->computeAndSendFibUpdates(item.batch,
-    [this, batch = item.batch, successCb = item.managerSuccessCallback] (const auto& routes) {
-      onFibUpdateSuccess(batch, routes, successCb);
-    },
-    [this, failureCb = item.managerFailureCallback] (const auto& code, const auto& error) {
-      onFibUpdateFailure(failureCb, code, error);
-    });
+  m_fibUpdater->computeAndSendFibUpdates(batch,
+    [this] (const auto& routes) { onFibUpdateSuccess(routes); },
+    [this] (const auto& code, const auto& error) { onFibUpdateFailure(code, error); });
 }
 
 void
-Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
-                        const RibUpdateList& inheritedRoutes,
-                        const Rib::UpdateSuccessCallback& onSuccess)
+Rib::onFibUpdateSuccess(const RibUpdateList& inheritedRoutes)
 {
-  for (const RibUpdate& update : batch) {
+  UpdateQueue items;
+  items.swap(m_inProgressUpdates);
+
+  for (const auto& item : items) {
+    const RibUpdate& update = item.update;
     switch (update.action) {
     case RibUpdate::REGISTER:
       insert(update.name, update.route);
@@ -426,8 +550,10 @@ Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
 
   m_isUpdateInProgress = false;
 
-  if (onSuccess != nullptr) {
-    onSuccess();
+  for (const auto& item : items) {
+    if (item.managerSuccessCallback != nullptr) {
+      item.managerSuccessCallback();
+    }
   }
 
   // Try to advance the batch queue
@@ -435,13 +561,17 @@ Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
 }
 
 void
-Rib::onFibUpdateFailure(const Rib::UpdateFailureCallback& onFailure,
-                        uint32_t code, const std::string& error)
+Rib::onFibUpdateFailure(uint32_t code, const std::string& error)
 {
+  UpdateQueue items;
+  items.swap(m_inProgressUpdates);
+
   m_isUpdateInProgress = false;
 
-  if (onFailure != nullptr) {
-    onFailure(code, error);
+  for (const auto& item : items) {
+    if (item.managerFailureCallback != nullptr) {
+      item.managerFailureCallback(code, error);
+    }
   }
 
   // Try to advance the batch queue
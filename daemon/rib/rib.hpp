@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -30,9 +30,11 @@
 #include "rib-update-batch.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
+#include <ndn-cxx/util/scheduler.hpp>
 
 #include <functional>
 #include <map>
+#include <set>
 
 namespace nfd::rib {
 
@@ -156,39 +158,44 @@ private:
                    const Rib::UpdateSuccessCallback& onSuccess,
                    const Rib::UpdateFailureCallback& onFailure);
 
-  /** \brief Send the first update batch in the queue, if no other update is in progress.
+  /** \brief Send a batch of queued updates, if no other update is in progress.
+   *
+   *  The batch starts with the first update in the queue, and takes the following queued updates
+   *  for the same face, up to MAX_UPDATE_BATCH_SIZE of them, as long as their FIB updates can be
+   *  computed independently.
    */
   void
   sendBatchFromQueue();
 
   void
-  onFibUpdateSuccess(const RibUpdateBatch& batch,
-                     const RibUpdateList& inheritedRoutes,
-                     const Rib::UpdateSuccessCallback& onSuccess);
+  onFibUpdateSuccess(const RibUpdateList& inheritedRoutes);
 
   void
-  onFibUpdateFailure(const Rib::UpdateFailureCallback& onFailure,
-                     uint32_t code, const std::string& error);
+  onFibUpdateFailure(uint32_t code, const std::string& error);
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   erase(const Name& prefix, const Route& route);
 
+public:
+  /// Maximum number of queued RIB updates that are sent to FibUpdater as one batch.
+  static constexpr size_t MAX_UPDATE_BATCH_SIZE = 256;
+  /// Maximum number of queued RIB updates examined when looking for updates to add to a batch.
+  static constexpr size_t MAX_UPDATE_BATCH_LOOKAHEAD = 1024;
+  /// Routes whose expiration times fall in the same interval of this length expire together.
+  static constexpr time::nanoseconds ROUTE_EXPIRATION_GRANULARITY = 100_ms;
+
 private:
   using RouteComparePredicate = bool (*)(const Route&, const Route&);
   using RouteSet = std::set<Route, RouteComparePredicate>;
 
-  /** \brief Find entries under \p prefix.
-   *  \pre a RIB entry exists at \p prefix
-   */
-  std::list<shared_ptr<RibEntry>>
-  findDescendants(const Name& prefix) const;
-
-  /** \brief Find entries under \p prefix.
-   *  \pre a RIB entry does not exist at \p prefix
+  /** \brief Find the entries that are, or would become, children of an entry at \p prefix.
+   *
+   *  These are the topmost entries strictly under \p prefix. The subtree below each of them is
+   *  skipped, so the cost depends on the number of children rather than descendants.
    */
-  std::list<shared_ptr<RibEntry>>
-  findDescendantsForNonInsertedName(const Name& prefix) const;
+  RibEntryList
+  findChildren(const Name& prefix) const;
 
   RibTable::iterator
   eraseEntry(RibTable::iterator it);
@@ -215,6 +222,32 @@ private:
   void
   modifyInheritedRoutes(const RibUpdateList& inheritedRoutes);
 
+  /** \brief Arranges for \p route of \p prefix to expire at its expiration time.
+   *
+   *  The route is placed in the bucket of its expiration time, rounded up to
+   *  ROUTE_EXPIRATION_GRANULARITY. A renewed route is moved out of its previous bucket,
+   *  so that each route is in at most one bucket.
+   */
+  void
+  scheduleExpiration(const Name& prefix, const Route& route);
+
+  /** \brief Removes \p route of \p prefix from its expiration bucket, if any.
+   */
+  void
+  cancelExpiration(const Name& prefix, const Route& route);
+
+  /** \brief Schedules expireRoutes() at the time of the earliest bucket.
+   */
+  void
+  scheduleNextExpiration();
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief Unregisters the expired routes in all buckets that are due, and sends them to
+   *         FibUpdater together.
+   */
+  void
+  expireRoutes();
+
 public:
   /** \brief Signals after a RIB entry is inserted.
    *
@@ -234,6 +267,10 @@ public:
    */
   signal::Signal<Rib, RibRouteRef> afterAddRoute;
 
+  /** \brief Signals after an existing Route is replaced, e.g., with a different cost or flags.
+   */
+  signal::Signal<Rib, RibRouteRef> afterUpdateRoute;
+
   /** \brief Signals before a route is removed.
    */
   signal::Signal<Rib, RibRouteRef> beforeRemoveRoute;
@@ -245,15 +282,41 @@ private:
   size_t m_nItems = 0;
   FibUpdater* m_fibUpdater = nullptr;
 
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  struct ExpiringRoute
+  {
+    Name prefix;
+    uint64_t faceId;
+    ndn::nfd::RouteOrigin origin;
+
+    friend bool
+    operator<(const ExpiringRoute& lhs, const ExpiringRoute& rhs) noexcept
+    {
+      return std::tie(lhs.prefix, lhs.faceId, lhs.origin) <
+             std::tie(rhs.prefix, rhs.faceId, rhs.origin);
+    }
+  };
+
+  /// Expiration time bucket => routes that expire in it.
+  std::map<time::steady_clock::time_point, std::set<ExpiringRoute>> m_expirationBuckets;
+  /// Route => its expiration time bucket, each route is in at most one bucket.
+  std::map<ExpiringRoute, time::steady_clock::time_point> m_expiringRoutes;
+
+private:
+  ndn::scheduler::ScopedEventId m_expirationEvent;
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   struct UpdateQueueItem
   {
-    RibUpdateBatch batch;
+    RibUpdate update;
     const Rib::UpdateSuccessCallback managerSuccessCallback;
     const Rib::UpdateFailureCallback managerFailureCallback;
   };
 
   using UpdateQueue = std::list<UpdateQueueItem>;
-  UpdateQueue m_updateBatches;
+  UpdateQueue m_updateQueue;
+  /// Updates of the batch being applied to the FIB; empty if no update is in progress.
+  UpdateQueue m_inProgressUpdates;
   bool m_isUpdateInProgress = false;
 
   friend FibUpdater;
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -31,7 +31,6 @@
 #include <ndn-cxx/encoding/nfd-constants.hpp>
 #include <ndn-cxx/mgmt/nfd/route-flags-traits.hpp>
 #include <ndn-cxx/prefix-announcement.hpp>
-#include <ndn-cxx/util/scheduler.hpp>
 
 #include <type_traits>
 
@@ -53,24 +52,6 @@ public:
    */
   Route(const ndn::PrefixAnnouncement& ann, uint64_t faceId);
 
-  const ndn::scheduler::EventId&
-  getExpirationEvent() const
-  {
-    return m_expirationEvent;
-  }
-
-  void
-  setExpirationEvent(ndn::scheduler::EventId&& eid)
-  {
-    m_expirationEvent = std::move(eid);
-  }
-
-  void
-  cancelExpirationEvent()
-  {
-    m_expirationEvent.cancel();
-  }
-
   std::underlying_type_t<ndn::nfd::RouteFlags>
   getFlags() const
   {
@@ -114,9 +95,6 @@ public:
    *  If this field is after the current time, it indicates when the prefix announcement expires.
    */
   time::steady_clock::time_point annExpires;
-
-private:
-  ndn::scheduler::EventId m_expirationEvent;
 };
 
 std::ostream&
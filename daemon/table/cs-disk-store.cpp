@@ -0,0 +1,210 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-disk-store.hpp"
+#include "common/global.hpp"
+#include "common/logger.hpp"
+
+#include <boost/asio/post.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <iterator>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace nfd::cs {
+
+NFD_LOG_INIT(CsDiskStore);
+
+DiskStore::DiskStore(const std::string& path, uint64_t maxBytes)
+  : m_path(path)
+  , m_maxBytes(maxBytes)
+  , m_ownerIo(getGlobalIoService())
+  , m_workGuard(boost::asio::make_work_guard(m_ioWorker))
+{
+  m_fd = ::open(path.data(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (m_fd < 0) {
+    NDN_THROW_ERRNO(Error("Cannot open " + path));
+  }
+  NFD_LOG_INFO("Opened " << path << " max-bytes=" << maxBytes);
+
+  // started only after the file is open, so that a failing constructor leaves no thread behind
+  m_worker = std::thread([this] { m_ioWorker.run(); });
+}
+
+DiskStore::~DiskStore()
+{
+  m_workGuard.reset();
+  m_worker.join();
+  ::close(m_fd);
+}
+
+void
+DiskStore::checkPath(const std::string& path)
+{
+  int fd = ::open(path.data(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    NDN_THROW_ERRNO(Error("Cannot open " + path));
+  }
+  ::close(fd);
+}
+
+void
+DiskStore::insert(const Data& data, time::steady_clock::time_point freshUntil)
+{
+  const Block& wire = data.wireEncode();
+  if (wire.size() > m_maxBytes) {
+    return;
+  }
+  if (m_nPendingWrites >= MAX_PENDING_WRITES) {
+    NFD_LOG_DEBUG("insert " << data.getName() << " dropped, " << m_nPendingWrites << " writes pending");
+    return;
+  }
+
+  auto existing = m_index.find(data.getFullName());
+  if (existing != m_index.end()) {
+    eraseRecord(existing);
+  }
+
+  if (m_writeOffset + wire.size() > m_maxBytes) {
+    // wrap around, overwriting the oldest packets
+    evictRange(m_writeOffset, m_maxBytes);
+    m_writeOffset = 0;
+  }
+  evictRange(m_writeOffset, m_writeOffset + wire.size());
+
+  ++m_nPendingWrites;
+  // the destructor joins the worker, so the DiskStore outlives every queued operation
+  boost::asio::post(m_ioWorker, [this, wire, offset = m_writeOffset] {
+    ssize_t nWritten = ::pwrite(m_fd, wire.data(), wire.size(), static_cast<off_t>(offset));
+    if (nWritten != static_cast<ssize_t>(wire.size())) {
+      // a later read of this record fails to decode, and is reported as a miss
+      NFD_LOG_WARN("write error at offset " << offset << ": " << std::strerror(errno));
+    }
+    --m_nPendingWrites;
+  });
+
+  auto it = m_index.emplace(data.getFullName(), Record{m_writeOffset, wire.size(), freshUntil}).first;
+  m_byOffset.emplace(m_writeOffset, it);
+  m_writeOffset += wire.size();
+  NFD_LOG_TRACE("insert " << data.getName() << " offset=" << it->second.offset);
+}
+
+bool
+DiskStore::find(const Interest& interest, FindCallback cb) const
+{
+  const Name& name = interest.getName();
+  auto first = m_index.lower_bound(name);
+  auto last = name.empty() ? m_index.end() : m_index.lower_bound(name.getSuccessor());
+
+  // every full name in [first, last) starts with the Interest name; without CanBePrefix,
+  // the Interest name must be either the full name or the Data name
+  auto match = std::find_if(first, last, [&] (const auto& p) {
+    if (!interest.getCanBePrefix() && p.first.size() > name.size() + 1) {
+      return false;
+    }
+    return !interest.getMustBeFresh() || p.second.freshUntil >= time::steady_clock::now();
+  });
+  if (match == last) {
+    return false;
+  }
+
+  const Record& record = match->second;
+  NFD_LOG_DEBUG("find " << name << " matching " << match->first);
+  boost::asio::post(m_ioWorker, [fd = m_fd, record, &ownerIo = m_ownerIo, cb = std::move(cb)] {
+    shared_ptr<Data> data;
+    auto buf = std::make_shared<ndn::Buffer>(record.length);
+    ssize_t nRead = ::pread(fd, buf->data(), buf->size(), static_cast<off_t>(record.offset));
+    if (nRead != static_cast<ssize_t>(buf->size())) {
+      NFD_LOG_WARN("read error at offset " << record.offset << ": " << std::strerror(errno));
+    }
+    else {
+      try {
+        data = make_shared<Data>(Block(std::move(buf)));
+      }
+      catch (const tlv::Error& e) {
+        NFD_LOG_WARN("decode error at offset " << record.offset << ": " << e.what());
+      }
+    }
+    boost::asio::post(ownerIo, [cb = std::move(cb), data = std::move(data), record] {
+      cb(std::move(data), record.freshUntil);
+    });
+  });
+  return true;
+}
+
+size_t
+DiskStore::erase(const Name& prefix, size_t limit)
+{
+  auto it = m_index.lower_bound(prefix);
+  auto last = prefix.empty() ? m_index.end() : m_index.lower_bound(prefix.getSuccessor());
+
+  size_t nErased = 0;
+  while (it != last && nErased < limit) {
+    eraseRecord(it++);
+    ++nErased;
+  }
+  return nErased;
+}
+
+void
+DiskStore::flush() const
+{
+  std::promise<void> done;
+  boost::asio::post(m_ioWorker, [&done] { done.set_value(); });
+  done.get_future().wait();
+}
+
+void
+DiskStore::evictRange(uint64_t begin, uint64_t end)
+{
+  // a record overlapping the range may start before begin
+  auto it = m_byOffset.upper_bound(begin);
+  if (it != m_byOffset.begin()) {
+    auto prev = std::prev(it);
+    if (prev->first + prev->second->second.length > begin) {
+      it = prev;
+    }
+  }
+
+  while (it != m_byOffset.end() && it->first < end) {
+    NFD_LOG_TRACE("evict " << it->second->first);
+    m_index.erase(it->second);
+    it = m_byOffset.erase(it);
+  }
+}
+
+void
+DiskStore::eraseRecord(Index::iterator it)
+{
+  m_byOffset.erase(it->second.offset);
+  m_index.erase(it);
+}
+
+} // namespace nfd::cs
@@ -0,0 +1,206 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_DISK_STORE_HPP
+#define NFD_DAEMON_TABLE_CS_DISK_STORE_HPP
+
+#include "core/common.hpp"
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include <atomic>
+#include <map>
+#include <thread>
+
+namespace nfd::cs {
+
+/**
+ * \brief A second-tier Content Store backed by a log file.
+ *
+ * Data packets evicted from the in-memory Content Store are appended to a log file of bounded
+ * size, and an in-memory index maps the full name of each stored packet to its location in
+ * the file. When the write position reaches the size limit, it wraps around to the beginning
+ * of the file, and packets that are overwritten are dropped from the index; therefore, packets
+ * are evicted from the disk tier in first-in-first-out order.
+ *
+ * The index is kept on the thread that owns the DiskStore, while reads and writes of the log
+ * file are performed in order on a dedicated worker thread, so that file I/O never blocks the
+ * forwarding thread. Because the worker executes them in order, a read always observes the
+ * writes that were queued before it, and a region of the file is not overwritten before the
+ * reads queued against it have completed.
+ *
+ * The index is not persisted. The log file is truncated when a DiskStore is constructed.
+ */
+class DiskStore : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * \brief Opens the log file.
+   * \param path path of the log file; it is created if it does not exist
+   * \param maxBytes maximum size of the log file
+   * \throw Error the file cannot be opened
+   */
+  DiskStore(const std::string& path, uint64_t maxBytes);
+
+  /**
+   * \brief Completes the queued file operations and closes the log file.
+   *
+   * Find callbacks of completed reads are still delivered afterwards.
+   */
+  ~DiskStore();
+
+  /**
+   * \brief Checks that a log file can be opened at \p path, without truncating it.
+   * \throw Error the file cannot be opened
+   */
+  static void
+  checkPath(const std::string& path);
+
+  const std::string&
+  getPath() const noexcept
+  {
+    return m_path;
+  }
+
+  uint64_t
+  getMaxBytes() const noexcept
+  {
+    return m_maxBytes;
+  }
+
+  /**
+   * \brief Returns the number of stored packets.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_index.size();
+  }
+
+  /**
+   * \brief Stores a Data packet.
+   * \param data the Data packet
+   * \param freshUntil time point at which \p data becomes non-fresh
+   *
+   * If a packet with the same full name is already stored, it is replaced.
+   * Packets larger than getMaxBytes() are not stored.
+   * The packet is indexed immediately, and written to the file asynchronously. If
+   * MAX_PENDING_WRITES writes are already queued, the packet is not stored, so that a slow disk
+   * does not accumulate an unbounded backlog of packets in memory.
+   */
+  void
+  insert(const Data& data, time::steady_clock::time_point freshUntil);
+
+  /**
+   * \brief Callback that receives the Data packet read by find(), or nullptr if it cannot be
+   *        read, and the time point at which the packet becomes non-fresh.
+   */
+  using FindCallback = std::function<void(shared_ptr<const Data>, time::steady_clock::time_point)>;
+
+  /**
+   * \brief Finds the first stored Data packet, in full name order, that can satisfy
+   *        \p interest, and reads it asynchronously.
+   * \return whether a match was found; if false, \p cb is not invoked
+   *
+   * \p cb is invoked through the io_context of the thread that constructed the DiskStore,
+   * always after find() returns.
+   */
+  bool
+  find(const Interest& interest, FindCallback cb) const;
+
+  /**
+   * \brief Erases up to \p limit packets under \p prefix.
+   * \return number of erased packets
+   */
+  size_t
+  erase(const Name& prefix, size_t limit);
+
+  /**
+   * \brief Blocks until the file operations queued so far have completed, and their find
+   *        callbacks have been queued.
+   */
+  void
+  flush() const;
+
+  /**
+   * \brief Returns the number of writes that are queued but not yet completed.
+   */
+  size_t
+  getNPendingWrites() const noexcept
+  {
+    return m_nPendingWrites;
+  }
+
+public:
+  /// Maximum number of queued writes, beyond which insert() drops packets
+  static constexpr size_t MAX_PENDING_WRITES = 1024;
+
+private:
+  struct Record
+  {
+    uint64_t offset;
+    size_t length;
+    time::steady_clock::time_point freshUntil;
+  };
+
+  using Index = std::map<Name, Record>; // indexed by full name
+
+  /**
+   * \brief Drops the packets stored in the byte range [begin, end) of the log file.
+   */
+  void
+  evictRange(uint64_t begin, uint64_t end);
+
+  void
+  eraseRecord(Index::iterator it);
+
+private:
+  const std::string m_path;
+  const uint64_t m_maxBytes;
+  int m_fd = -1;
+  uint64_t m_writeOffset = 0;
+  Index m_index;
+  std::map<uint64_t, Index::iterator> m_byOffset; ///< index entries ordered by file offset
+
+  std::atomic<size_t> m_nPendingWrites{0};
+
+  boost::asio::io_context& m_ownerIo; ///< receives the find callbacks
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  mutable boost::asio::io_context m_ioWorker; ///< executes file operations in order
+private:
+  boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_workGuard;
+  std::thread m_worker;
+};
+
+} // namespace nfd::cs
+
+#endif // NFD_DAEMON_TABLE_CS_DISK_STORE_HPP
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -34,6 +34,15 @@ Entry::Entry(shared_ptr<const Data> data, bool isUnsolicited)
   updateFreshUntil();
 }
 
+size_t
+Entry::computeSize(const Data& data)
+{
+  // approximates the memory held by the Data object itself and its slot in the Table
+  constexpr size_t ENTRY_OVERHEAD = sizeof(Entry) + sizeof(Data);
+  // the whole buffer backing the wire encoding is kept alive, not only the encoding
+  return data.wireEncode().getBuffer()->size() + ENTRY_OVERHEAD;
+}
+
 bool
 Entry::isFresh() const
 {
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -69,6 +69,31 @@ public: // exposed through ContentStore enumeration
     return m_isUnsolicited;
   }
 
+  /** \brief Return the number of bytes charged to this entry against the CS byte limit.
+   *
+   *  This is the size of the buffer backing the Data wire encoding plus a fixed per-entry
+   *  overhead. Cs copies a Data packet whose buffer is much larger than its wire encoding
+   *  before storing it, see Cs::MAX_BUFFER_RATIO.
+   */
+  size_t
+  getSize() const
+  {
+    return computeSize(*m_data);
+  }
+
+  /** \brief Return the number of bytes that an entry storing \p data would be charged.
+   */
+  static size_t
+  computeSize(const Data& data);
+
+  /** \brief Return the time point at which the stored Data becomes non-fresh.
+   */
+  time::steady_clock::time_point
+  getFreshUntil() const
+  {
+    return m_freshUntil;
+  }
+
   /** \brief Check if the stored Data is fresh now.
    */
   bool
@@ -87,6 +112,14 @@ public: // used by ContentStore implementation
   void
   updateFreshUntil();
 
+  /** \brief Set the time point at which the entry becomes non-fresh.
+   */
+  void
+  setFreshUntil(time::steady_clock::time_point freshUntil)
+  {
+    m_freshUntil = freshUntil;
+  }
+
   /** \brief Clear 'unsolicited' flag.
    */
   void
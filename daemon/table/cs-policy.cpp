@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -71,6 +71,21 @@ Policy::setLimit(size_t nMaxEntries)
   this->evictEntries();
 }
 
+void
+Policy::setByteLimit(size_t nMaxBytes)
+{
+  NFD_LOG_INFO("setByteLimit " << nMaxBytes);
+  m_byteLimit = nMaxBytes;
+  this->evictEntries();
+}
+
+bool
+Policy::isOverLimit() const
+{
+  BOOST_ASSERT(m_cs != nullptr);
+  return m_cs->size() > m_limit || m_cs->sizeInBytes() > m_byteLimit;
+}
+
 void
 Policy::afterInsert(EntryRef i)
 {
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -29,6 +29,7 @@
 #include "cs-entry.hpp"
 
 #include <functional>
+#include <limits>
 #include <map>
 #include <set>
 
@@ -110,6 +111,24 @@ public:
   void
   setLimit(size_t nMaxEntries);
 
+  /**
+   * \brief Gets hard limit (in bytes, as computed by Entry::getSize()).
+   */
+  size_t
+  getByteLimit() const noexcept
+  {
+    return m_byteLimit;
+  }
+
+  /** \brief Sets hard limit (in bytes, as computed by Entry::getSize()).
+   *  \post getByteLimit() == nMaxBytes
+   *  \post cs.sizeInBytes() <= getByteLimit()
+   *
+   *  The policy may evict entries if necessary.
+   */
+  void
+  setByteLimit(size_t nMaxBytes);
+
 public:
   /** \brief A reference to a CS entry.
    *  \note `operator<` of EntryRef compares the Data name enclosed in the Entry.
@@ -124,7 +143,7 @@ public:
   signal::Signal<Policy, EntryRef> beforeEvict;
 
   /** \brief Invoked by CS after a new entry is inserted.
-   *  \post cs.size() <= getLimit()
+   *  \post cs.size() <= getLimit() && cs.sizeInBytes() <= getByteLimit()
    *
    *  The policy may evict entries if necessary.
    *  During this process, \p i might be evicted.
@@ -190,11 +209,16 @@ protected:
   doBeforeUse(EntryRef i) = 0;
 
   /** \brief Evicts zero or more entries.
-   *  \post CS size does not exceed hard limit
+   *  \post CS size does not exceed hard limits
    */
   virtual void
   evictEntries() = 0;
 
+  /** \brief Returns whether the CS exceeds either the packet limit or the byte limit.
+   */
+  bool
+  isOverLimit() const;
+
 protected:
   explicit
   Policy(std::string_view policyName);
@@ -211,6 +235,7 @@ private: // registry
 private:
   const std::string m_policyName;
   size_t m_limit;
+  size_t m_byteLimit = std::numeric_limits<size_t>::max();
   Cs* m_cs;
 };
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -33,6 +33,16 @@ namespace nfd::cs {
 
 NFD_LOG_INIT(ContentStore);
 
+static void
+eraseFromIndex(std::unordered_multimap<name_tree::HashValue, Table::const_iterator>& index,
+               name_tree::HashValue hash, Table::const_iterator it)
+{
+  auto [first, last] = index.equal_range(hash);
+  auto pos = std::find_if(first, last, [it] (const auto& p) { return p.second == it; });
+  BOOST_ASSERT(pos != last);
+  index.erase(pos);
+}
+
 static unique_ptr<Policy>
 makeDefaultPolicy()
 {
@@ -48,7 +58,21 @@ Cs::Cs(size_t nMaxPackets)
 void
 Cs::insert(const Data& data, bool isUnsolicited)
 {
-  if (!m_shouldAdmit || m_policy->getLimit() == 0) {
+  insertImpl(data, isUnsolicited, std::nullopt);
+}
+
+void
+Cs::promote(const Data& data, time::steady_clock::time_point freshUntil)
+{
+  NFD_LOG_DEBUG("promote " << data.getName());
+  insertImpl(data, false, freshUntil);
+}
+
+void
+Cs::insertImpl(const Data& data, bool isUnsolicited,
+               std::optional<time::steady_clock::time_point> freshUntil)
+{
+  if (!m_shouldAdmit || m_policy->getLimit() == 0 || m_policy->getByteLimit() == 0) {
     return;
   }
   NFD_LOG_DEBUG("insert " << data.getName());
@@ -62,10 +86,27 @@ Cs::insert(const Data& data, bool isUnsolicited)
     }
   }
 
-  auto [it, isNewEntry] = m_table.emplace(data.shared_from_this(), isUnsolicited);
+  shared_ptr<const Data> stored = data.shared_from_this();
+  const Block& wire = data.wireEncode();
+  if (wire.getBuffer()->size() > MAX_BUFFER_RATIO * wire.size()) {
+    stored = make_shared<Data>(Block(span<const uint8_t>(wire.data(), wire.size())));
+  }
+
+  // a packet that alone exceeds the byte limit would only evict everything else, then itself
+  if (Entry::computeSize(*stored) > m_policy->getByteLimit()) {
+    NFD_LOG_DEBUG("insert " << data.getName() << " exceeds byte limit, not stored");
+    return;
+  }
+
+  auto [it, isNewEntry] = m_table.emplace(std::move(stored), isUnsolicited);
   auto& entry = const_cast<Entry&>(*it);
 
-  entry.updateFreshUntil();
+  if (freshUntil) {
+    entry.setFreshUntil(*freshUntil);
+  }
+  else {
+    entry.updateFreshUntil();
+  }
 
   if (!isNewEntry) { // existing entry
     // XXX This doesn't forbid unsolicited Data from refreshing a solicited entry.
@@ -75,6 +116,9 @@ Cs::insert(const Data& data, bool isUnsolicited)
     m_policy->afterRefresh(it);
   }
   else {
+    m_nameIndex.emplace(name_tree::getHashes(entry.getData()).back(), it);
+    m_fullNameIndex.emplace(name_tree::computeHash(entry.getFullName()), it);
+    m_nBytes += entry.getSize();
     m_policy->afterInsert(it);
   }
 }
@@ -99,7 +143,7 @@ Cs::eraseImpl(const Name& prefix, size_t limit)
   size_t nErased = 0;
   while (i != last && nErased < limit) {
     m_policy->beforeErase(i);
-    i = m_table.erase(i);
+    i = eraseEntry(i);
     ++nErased;
   }
   return nErased;
@@ -113,11 +157,20 @@ Cs::findImpl(const Interest& interest) const
   }
 
   const Name& prefix = interest.getName();
-  auto range = findPrefixRange(prefix);
-  auto match = std::find_if(range.first, range.second,
-                            [&interest] (const auto& entry) { return entry.canSatisfy(interest); });
+  const_iterator match;
+  if (interest.getCanBePrefix()) {
+    auto range = findPrefixRange(prefix);
+    match = std::find_if(range.first, range.second,
+                         [&interest] (const auto& entry) { return entry.canSatisfy(interest); });
+    if (match == range.second) {
+      match = m_table.end();
+    }
+  }
+  else {
+    match = findExactImpl(interest);
+  }
 
-  if (match == range.second) {
+  if (match == m_table.end()) {
     NFD_LOG_DEBUG("find " << prefix << " no-match");
     return m_table.end();
   }
@@ -126,14 +179,49 @@ Cs::findImpl(const Interest& interest) const
   return match;
 }
 
+Cs::const_iterator
+Cs::findExactImpl(const Interest& interest) const
+{
+  // Candidates are Data whose name equals the Interest name, or whose full name equals the
+  // Interest name if it ends with an implicit digest. canSatisfy() rejects hash collisions.
+  // If several candidates satisfy the Interest, the first in Table order is chosen, so that
+  // the result is the same as a search in the Table.
+  name_tree::HashValue hash = name_tree::getHashes(interest).back();
+  auto match = m_table.end();
+  auto consider = [&] (const HashIndex& index) {
+    auto [first, last] = index.equal_range(hash);
+    for (; first != last; ++first) {
+      auto it = first->second;
+      if ((match == m_table.end() || *it < *match) && it->canSatisfy(interest)) {
+        match = it;
+      }
+    }
+  };
+  consider(m_nameIndex);
+  consider(m_fullNameIndex);
+  return match;
+}
+
+Cs::const_iterator
+Cs::eraseEntry(const_iterator it)
+{
+  eraseFromIndex(m_nameIndex, name_tree::getHashes(it->getData()).back(), it);
+  eraseFromIndex(m_fullNameIndex, name_tree::computeHash(it->getFullName()), it);
+  BOOST_ASSERT(m_nBytes >= it->getSize());
+  m_nBytes -= it->getSize();
+  return m_table.erase(it);
+}
+
 void
 Cs::setPolicy(unique_ptr<Policy> policy)
 {
   BOOST_ASSERT(policy != nullptr);
   BOOST_ASSERT(m_policy != nullptr);
   size_t limit = m_policy->getLimit();
+  size_t byteLimit = m_policy->getByteLimit();
   this->setPolicyImpl(std::move(policy));
   m_policy->setLimit(limit);
+  m_policy->setByteLimit(byteLimit);
 }
 
 void
@@ -141,7 +229,12 @@ Cs::setPolicyImpl(unique_ptr<Policy> policy)
 {
   NFD_LOG_DEBUG("set-policy " << policy->getName());
   m_policy = std::move(policy);
-  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) { m_table.erase(it); });
+  m_beforeEvictConnection = m_policy->beforeEvict.connect([this] (auto it) {
+    if (m_diskStore != nullptr && !it->isUnsolicited()) {
+      m_diskStore->insert(it->getData(), it->getFreshUntil());
+    }
+    eraseEntry(it);
+  });
 
   m_policy->setCs(this);
   BOOST_ASSERT(m_policy->getCs() == this);
@@ -167,4 +260,16 @@ Cs::enableServe(bool shouldServe) noexcept
   NFD_LOG_INFO((shouldServe ? "Enabling" : "Disabling") << " Data serving");
 }
 
+void
+Cs::setDiskStore(unique_ptr<DiskStore> diskStore)
+{
+  if (diskStore != nullptr) {
+    NFD_LOG_INFO("Enabling disk tier at " << diskStore->getPath());
+  }
+  else if (m_diskStore != nullptr) {
+    NFD_LOG_INFO("Disabling disk tier");
+  }
+  m_diskStore = std::move(diskStore);
+}
+
 } // namespace nfd::cs
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,7 +26,11 @@
 #ifndef NFD_DAEMON_TABLE_CS_HPP
 #define NFD_DAEMON_TABLE_CS_HPP
 
+#include "cs-disk-store.hpp"
 #include "cs-policy.hpp"
+#include "name-tree-hashtable.hpp"
+
+#include <unordered_map>
 
 namespace nfd {
 namespace cs {
@@ -39,7 +43,18 @@ namespace cs {
  *  Data packets are wrapped in Entry objects. Each Entry contains the Data packet itself,
  *  and a few additional attributes such as when the Data becomes non-fresh.
  *
+ *  Two hash indexes, keyed by the hash of the Data name and of the full name, are maintained
+ *  alongside the Table. An Interest without CanBePrefix can only match entries whose name or
+ *  full name equals the Interest name, so it is served from the hash indexes with a single
+ *  probe. The Table is used for lookups with CanBePrefix and for erasing by prefix.
+ *
  *  The replacement policy is implemented in a subclass of \c Policy.
+ *
+ *  Optionally, a DiskStore can be attached as a second tier. Solicited Data packets evicted by
+ *  the replacement policy are written to the DiskStore, and a lookup that misses the in-memory
+ *  Table is retried in the DiskStore before the miss callback is invoked. A Data packet found in
+ *  the DiskStore is read on the DiskStore worker thread, delivered to the hit callback after
+ *  find() has returned, and inserted back into the in-memory Table.
  */
 class Cs : noncopyable
 {
@@ -64,6 +79,9 @@ public:
   erase(const Name& prefix, size_t limit, AfterEraseCallback&& cb)
   {
     size_t nErased = eraseImpl(prefix, limit);
+    if (m_diskStore != nullptr && nErased < limit) {
+      nErased += m_diskStore->erase(prefix, limit - nErased);
+    }
     cb(nErased);
   }
 
@@ -73,19 +91,47 @@ public:
    *  \param interest the Interest for lookup
    *  \param hit a callback if a match is found; must not be empty
    *  \param miss a callback if there's no match; must not be empty
+   *  \return whether the lookup continues in the DiskStore, i.e., the callback is invoked
+   *          after find() returns
    *  \note A lookup invokes either callback exactly once.
-   *        The callback may be invoked either before or after find() returns
+   *        The callback may be invoked either before or after find() returns;
+   *        it is invoked after find() returns when the lookup continues in the DiskStore.
+   *        If the Cs is destroyed first, lookups that are still pending are abandoned.
+   *  \pre \p interest is owned by a shared_ptr
    */
   template<typename HitCallback, typename MissCallback>
-  void
-  find(const Interest& interest, HitCallback&& hit, MissCallback&& miss) const
+  bool
+  find(const Interest& interest, HitCallback&& hit, MissCallback&& miss)
   {
     auto match = findImpl(interest);
-    if (match == m_table.end()) {
+    if (match != m_table.end()) {
+      hit(interest, match->getData());
+      return false;
+    }
+
+    if (m_diskStore == nullptr || !m_shouldServe) {
+      miss(interest);
+      return false;
+    }
+
+    // the caller's Interest must outlive an asynchronous lookup
+    bool isPending = m_diskStore->find(interest,
+      [this, token = weak_ptr<int>(m_lifetimeToken), interest = interest.shared_from_this(), hit, miss]
+      (shared_ptr<const Data> data, time::steady_clock::time_point freshUntil) {
+        if (token.expired()) {
+          return;
+        }
+        if (data == nullptr) {
+          miss(*interest);
+          return;
+        }
+        promote(*data, freshUntil);
+        hit(*interest, *data);
+      });
+    if (!isPending) {
       miss(interest);
-      return;
     }
-    hit(interest, match->getData());
+    return isPending;
   }
 
   /** \brief Get number of stored packets.
@@ -96,6 +142,21 @@ public:
     return m_table.size();
   }
 
+  /** \brief Get total size of stored packets (in bytes, as computed by Entry::getSize()).
+   */
+  size_t
+  sizeInBytes() const noexcept
+  {
+    return m_nBytes;
+  }
+
+public:
+  /** \brief A Data packet whose wire encoding is backed by a buffer more than this many times
+   *         its size is copied before being stored, so that an entry does not keep alive the
+   *         buffer it was received into.
+   */
+  static constexpr size_t MAX_BUFFER_RATIO = 2;
+
 public: // configuration
   /** \brief Get capacity (in number of packets).
    */
@@ -113,6 +174,22 @@ public: // configuration
     return m_policy->setLimit(nMaxPackets);
   }
 
+  /** \brief Get capacity (in bytes).
+   */
+  size_t
+  getByteLimit() const noexcept
+  {
+    return m_policy->getByteLimit();
+  }
+
+  /** \brief Change capacity (in bytes).
+   */
+  void
+  setByteLimit(size_t nMaxBytes)
+  {
+    return m_policy->setByteLimit(nMaxBytes);
+  }
+
   /** \brief Get replacement policy.
    */
   Policy*
@@ -157,6 +234,21 @@ public: // configuration
   void
   enableServe(bool shouldServe) noexcept;
 
+  /** \brief Get second-tier DiskStore, or nullptr if none is attached.
+   */
+  DiskStore*
+  getDiskStore() const noexcept
+  {
+    return m_diskStore.get();
+  }
+
+  /** \brief Attach or detach (if nullptr) a second-tier DiskStore.
+   *
+   *  The previously attached DiskStore, if any, is discarded along with its contents.
+   */
+  void
+  setDiskStore(unique_ptr<DiskStore> diskStore);
+
 public: // enumeration
   using const_iterator = Table::const_iterator;
 
@@ -182,13 +274,43 @@ private:
   const_iterator
   findImpl(const Interest& interest) const;
 
+  /** \brief Finds the best match for an Interest without CanBePrefix using the hash indexes.
+   */
+  const_iterator
+  findExactImpl(const Interest& interest) const;
+
+  /** \brief Inserts a Data packet read from the DiskStore back into the Table, keeping the
+   *         freshness it had when it was evicted.
+   */
+  void
+  promote(const Data& data, time::steady_clock::time_point freshUntil);
+
+  /** \brief Inserts a Data packet, setting its freshness to \p freshUntil if provided.
+   */
+  void
+  insertImpl(const Data& data, bool isUnsolicited,
+             std::optional<time::steady_clock::time_point> freshUntil);
+
+  /** \brief Erases an entry from the Table and the hash indexes.
+   */
+  const_iterator
+  eraseEntry(const_iterator it);
+
   void
   setPolicyImpl(unique_ptr<Policy> policy);
 
 private:
+  using HashIndex = std::unordered_multimap<name_tree::HashValue, const_iterator>;
+
   Table m_table;
+  HashIndex m_nameIndex;     ///< entries keyed by hash of Data name
+  HashIndex m_fullNameIndex; ///< entries keyed by hash of full name
+  size_t m_nBytes = 0;       ///< sum of Entry::getSize() over all entries
   unique_ptr<Policy> m_policy;
   signal::ScopedConnection m_beforeEvictConnection;
+  unique_ptr<DiskStore> m_diskStore;
+  /// expires when the Cs is destroyed, so that pending DiskStore lookups are abandoned
+  shared_ptr<int> m_lifetimeToken = make_shared<int>();
 
   bool m_shouldAdmit = true; ///< if false, no Data will be admitted
   bool m_shouldServe = true; ///< if false, all lookups will miss
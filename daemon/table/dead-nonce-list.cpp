@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -28,12 +28,27 @@
 #include "common/global.hpp"
 #include "common/logger.hpp"
 
+#include <algorithm>
+
 namespace nfd {
 
 NFD_LOG_INIT(DeadNonceList);
 
-DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
+std::ostream&
+operator<<(std::ostream& os, DeadNonceListStorage storage)
+{
+  switch (storage) {
+    case DeadNonceListStorage::EXACT:
+      return os << "exact";
+    case DeadNonceListStorage::FILTER:
+      return os << "filter";
+  }
+  return os << "unknown";
+}
+
+DeadNonceList::DeadNonceList(time::nanoseconds lifetime, DeadNonceListStorage storage)
   : m_lifetime(lifetime)
+  , m_storage(storage)
   , m_capacity(INITIAL_CAPACITY)
   , m_markInterval(m_lifetime / EXPECTED_MARK_COUNT)
   , m_adjustCapacityInterval(m_lifetime)
@@ -42,9 +57,7 @@ DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
     NDN_THROW(std::invalid_argument("lifetime is less than MIN_LIFETIME"));
   }
 
-  for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
-    m_queue.push_back(MARK);
-  }
+  resetStorage();
 
   m_markEvent = getScheduler().schedule(m_markInterval, [this] { mark(); });
   m_adjustCapacityEvent = getScheduler().schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
@@ -59,25 +72,88 @@ DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
   BOOST_ASSERT_MSG(CAPACITY_UP > 1.0, "CAPACITY_UP must adjust up");
   BOOST_ASSERT_MSG(CAPACITY_DOWN < 1.0, "CAPACITY_DOWN must adjust down");
   static_assert(EVICT_LIMIT >= 1);
+  static_assert(MIN_FILTER_BUCKETS * CuckooFilter::BUCKET_SIZE <= MIN_CAPACITY);
+}
+
+void
+DeadNonceList::setStorage(DeadNonceListStorage storage)
+{
+  if (storage == m_storage) {
+    return;
+  }
+
+  NFD_LOG_DEBUG("storage " << m_storage << " -> " << storage);
+  m_storage = storage;
+  resetStorage();
+}
+
+void
+DeadNonceList::resetStorage()
+{
+  m_index.clear();
+  m_slices.clear();
+  m_actualMarkCounts.clear();
+
+  if (m_storage == DeadNonceListStorage::FILTER) {
+    for (size_t i = 0; i <= EXPECTED_MARK_COUNT; ++i) {
+      m_slices.emplace_back();
+      m_slices.back().emplace_back(MIN_FILTER_BUCKETS);
+    }
+  }
+  else {
+    for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
+      m_queue.push_back(MARK);
+    }
+  }
 }
 
 size_t
 DeadNonceList::size() const
 {
+  if (m_storage == DeadNonceListStorage::FILTER) {
+    size_t n = 0;
+    for (const auto& slice : m_slices) {
+      for (const auto& filter : slice) {
+        n += filter.size();
+      }
+    }
+    return n;
+  }
+
   return m_queue.size() - countMarks();
 }
 
 bool
-DeadNonceList::has(const Name& name, Interest::Nonce nonce) const
+DeadNonceList::has(const Name& name, const name_tree::HashSequence& hashes,
+                   Interest::Nonce nonce) const
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
+  BOOST_ASSERT(hashes.size() == name.size() + 1);
+  Entry entry = DeadNonceList::makeEntry(hashes, nonce);
+
+  if (m_storage == DeadNonceListStorage::FILTER) {
+    return std::any_of(m_slices.begin(), m_slices.end(), [entry] (const auto& slice) {
+      return std::any_of(slice.begin(), slice.end(), [entry] (const CuckooFilter& filter) {
+        return filter.contains(entry);
+      });
+    });
+  }
+
   return m_ht.find(entry) != m_ht.end();
 }
 
 void
-DeadNonceList::add(const Name& name, Interest::Nonce nonce)
+DeadNonceList::add(const Name& name, const name_tree::HashSequence& hashes,
+                   Interest::Nonce nonce)
 {
-  Entry entry = DeadNonceList::makeEntry(name, nonce);
+  BOOST_ASSERT(hashes.size() == name.size() + 1);
+  Entry entry = DeadNonceList::makeEntry(hashes, nonce);
+
+  if (m_storage == DeadNonceListStorage::FILTER) {
+    NFD_LOG_TRACE("adding " << name << " nonce=" << nonce);
+    addToSlices(entry);
+    return;
+  }
+
   const auto iter = m_ht.find(entry);
   bool isDuplicate = iter != m_ht.end();
 
@@ -93,12 +169,19 @@ DeadNonceList::add(const Name& name, Interest::Nonce nonce)
 }
 
 DeadNonceList::Entry
-DeadNonceList::makeEntry(const Name& name, Interest::Nonce nonce)
+DeadNonceList::makeEntry(const name_tree::HashSequence& hashes, Interest::Nonce nonce)
 {
-  const auto& nameWire = name.wireEncode();
   uint32_t n;
   std::memcpy(&n, nonce.data(), sizeof(n));
-  return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.data()), nameWire.size(), n);
+
+  // The per-prefix hash values are XOR-combined component hashes, so the last one alone would
+  // not distinguish names that differ only in component order. Chaining every prefix hash
+  // through a non-invertible mixing step keeps the entry order-sensitive and MARK-resistant.
+  uint64_t h = Hash128to64(uint128(n, hashes.size()));
+  for (size_t i = 1; i < hashes.size(); ++i) {
+    h = Hash128to64(uint128(h, hashes[i]));
+  }
+  return h;
 }
 
 size_t
@@ -110,6 +193,12 @@ DeadNonceList::countMarks() const
 void
 DeadNonceList::mark()
 {
+  if (m_storage == DeadNonceListStorage::FILTER) {
+    rotateSlices();
+    m_markEvent = getScheduler().schedule(m_markInterval, [this] { mark(); });
+    return;
+  }
+
   m_queue.push_back(MARK);
   size_t nMarks = countMarks();
   m_actualMarkCounts.insert(nMarks);
@@ -122,6 +211,12 @@ DeadNonceList::mark()
 void
 DeadNonceList::adjustCapacity()
 {
+  if (m_storage == DeadNonceListStorage::FILTER) {
+    // filters are sized from the number of entries in the previous slice instead
+    m_adjustCapacityEvent = getScheduler().schedule(m_adjustCapacityInterval, [this] { adjustCapacity(); });
+    return;
+  }
+
   auto oldCapacity = m_capacity;
   auto equalRange = m_actualMarkCounts.equal_range(EXPECTED_MARK_COUNT);
   if (equalRange.second == m_actualMarkCounts.begin()) {
@@ -158,4 +253,57 @@ DeadNonceList::evictEntries()
   NFD_LOG_TRACE("evicted=" << nEvict << " size=" << size() << " capacity=" << m_capacity);
 }
 
+void
+DeadNonceList::addToSlices(Entry entry)
+{
+  auto& slice = m_slices.back();
+  // a duplicate in the current slice already has the longest remaining lifetime
+  if (std::any_of(slice.begin(), slice.end(),
+                  [entry] (const CuckooFilter& filter) { return filter.contains(entry); })) {
+    return;
+  }
+
+  if (slice.back().insert(entry)) {
+    return;
+  }
+
+  // the current filter is full: chain a larger one, unless the slice is already at its share
+  // of MAX_CAPACITY, in which case start a new slice early, shortening the lifetime of the
+  // oldest entries as the EXACT storage would do when evicting at MAX_CAPACITY
+  size_t sliceCapacity = 0;
+  for (const auto& filter : slice) {
+    sliceCapacity += filter.getCapacity();
+  }
+  if (sliceCapacity >= MAX_CAPACITY / EXPECTED_MARK_COUNT) {
+    rotateSlices();
+  }
+  else {
+    slice.emplace_back(slice.back().getCapacity() / CuckooFilter::BUCKET_SIZE * 2);
+  }
+
+  [[maybe_unused]] bool isInserted = m_slices.back().back().insert(entry);
+  BOOST_ASSERT(isInserted);
+}
+
+void
+DeadNonceList::rotateSlices()
+{
+  // size the new filter from the previous slice, so that it rarely needs to be chained
+  size_t nEntries = 0;
+  for (const auto& filter : m_slices.back()) {
+    nEntries += filter.size();
+  }
+  size_t nBuckets = MIN_FILTER_BUCKETS;
+  while (nBuckets * CuckooFilter::BUCKET_SIZE * 9 / 10 < nEntries &&
+         nBuckets * CuckooFilter::BUCKET_SIZE < MAX_CAPACITY / EXPECTED_MARK_COUNT) {
+    nBuckets <<= 1;
+  }
+
+  m_slices.pop_front();
+  m_slices.emplace_back();
+  m_slices.back().emplace_back(nBuckets);
+
+  NFD_LOG_TRACE("rotate nEntries=" << nEntries << " nBuckets=" << nBuckets << " size=" << size());
+}
+
 } // namespace nfd
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,7 +26,8 @@
 #ifndef NFD_DAEMON_TABLE_DEAD_NONCE_LIST_HPP
 #define NFD_DAEMON_TABLE_DEAD_NONCE_LIST_HPP
 
-#include "core/common.hpp"
+#include "name-tree-hashtable.hpp"
+#include "common/cuckoo-filter.hpp"
 
 #include <ndn-cxx/util/scheduler.hpp>
 
@@ -34,8 +35,25 @@
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/sequenced_index.hpp>
 
+#include <deque>
+
 namespace nfd {
 
+/**
+ * \brief Indicates how DeadNonceList stores its entries.
+ */
+enum class DeadNonceListStorage {
+  /// Entries are kept in a hashed and sequenced container, without false positives
+  /// beyond hash collisions. Each entry costs a container node.
+  EXACT,
+  /// Entries are kept in a rotating set of cuckoo filters, one per time slice.
+  /// Each entry costs about 2 bytes, with a small rate of false positives.
+  FILTER,
+};
+
+std::ostream&
+operator<<(std::ostream& os, DeadNonceListStorage storage);
+
 /**
  * \brief Represents the Dead Nonce List.
  *
@@ -43,7 +61,9 @@ namespace nfd {
  * When a Nonce is erased (dead) from a PIT entry, the Nonce and the Interest Name are added to
  * the Dead Nonce List and kept for a duration in which most loops are expected to have occured.
  *
- * To reduce memory usage, the Interest Name and Nonce are stored as a 64-bit hash.
+ * To reduce memory usage, the Interest Name and Nonce are stored as a 64-bit hash,
+ * which is derived from the name's per-prefix hash values (see name_tree::computeHashes),
+ * so that the hash values computed once per packet can be shared with the NameTree.
  * The probability of false positives (a non-looping Interest considered as looping) is small
  * and a collision is recoverable when the consumer retransmits with a different Nonce.
  *
@@ -52,6 +72,12 @@ namespace nfd {
  * At fixed intervals, a MARK (an entry with a special value) is inserted into the container.
  * The number of MARKs stored in the container reflects the lifetime of the entries,
  * because MARKs are inserted at fixed intervals.
+ *
+ * With DeadNonceListStorage::FILTER, entries are instead inserted into the cuckoo filters of
+ * the current time slice. At the interval at which MARKs would be inserted, a new slice is
+ * started and the oldest slice is dropped, so that every entry is kept for at least the
+ * lifetime. A slice grows by chaining larger filters as they become full. This trades a
+ * false positive rate of about 0.012% per filter for a much smaller memory footprint.
  */
 class DeadNonceList : noncopyable
 {
@@ -61,23 +87,46 @@ public:
    * \param lifetime expected lifetime of each nonce, must be no less than #MIN_LIFETIME.
    *        This should be set to a duration over which most loops would have occured.
    *        A loop cannot be detected if the total delay of the cycle is greater than lifetime.
+   * \param storage how entries are stored
    * \throw std::invalid_argument if lifetime is less than #MIN_LIFETIME
    */
   explicit
-  DeadNonceList(time::nanoseconds lifetime = DEFAULT_LIFETIME);
+  DeadNonceList(time::nanoseconds lifetime = DEFAULT_LIFETIME,
+                DeadNonceListStorage storage = DeadNonceListStorage::EXACT);
 
   /**
    * \brief Determines if name+nonce is in the list
    * \return true if name+nonce exists, false otherwise
    */
   bool
-  has(const Name& name, Interest::Nonce nonce) const;
+  has(const Name& name, Interest::Nonce nonce) const
+  {
+    return this->has(name, name_tree::computeHashes(name), nonce);
+  }
+
+  /**
+   * \brief Determines if name+nonce is in the list, using precomputed hash values
+   * \param hashes hash values of the prefixes of \p name, must equal computeHashes(name)
+   * \return true if name+nonce exists, false otherwise
+   */
+  bool
+  has(const Name& name, const name_tree::HashSequence& hashes, Interest::Nonce nonce) const;
 
   /**
    * \brief Adds name+nonce to the list
    */
   void
-  add(const Name& name, Interest::Nonce nonce);
+  add(const Name& name, Interest::Nonce nonce)
+  {
+    this->add(name, name_tree::computeHashes(name), nonce);
+  }
+
+  /**
+   * \brief Adds name+nonce to the list, using precomputed hash values
+   * \param hashes hash values of the prefixes of \p name, must equal computeHashes(name)
+   */
+  void
+  add(const Name& name, const name_tree::HashSequence& hashes, Interest::Nonce nonce);
 
   /**
    * \brief Returns the number of stored nonces
@@ -95,11 +144,27 @@ public:
     return m_lifetime;
   }
 
+  /**
+   * \brief Returns how entries are stored
+   */
+  DeadNonceListStorage
+  getStorage() const
+  {
+    return m_storage;
+  }
+
+  /**
+   * \brief Changes how entries are stored
+   * \post All entries are removed if \p storage differs from getStorage().
+   */
+  void
+  setStorage(DeadNonceListStorage storage);
+
 private:
   using Entry = uint64_t;
 
   static Entry
-  makeEntry(const Name& name, Interest::Nonce nonce);
+  makeEntry(const name_tree::HashSequence& hashes, Interest::Nonce nonce);
 
   /** \brief Return the number of MARKs in the index
    */
@@ -124,6 +189,21 @@ private:
   void
   evictEntries();
 
+  /** \brief Remove all entries and reinitialize the storage
+   */
+  void
+  resetStorage();
+
+  /** \brief Add an entry to the current time slice
+   */
+  void
+  addToSlices(Entry entry);
+
+  /** \brief Start a new time slice and drop the oldest one
+   */
+  void
+  rotateSlices();
+
 public:
   /// Default entry lifetime
   static constexpr time::nanoseconds DEFAULT_LIFETIME = 6_s;
@@ -132,6 +212,7 @@ public:
 
 private:
   const time::nanoseconds m_lifetime;
+  DeadNonceListStorage m_storage;
 
   struct Queue {};
   struct Hashtable {};
@@ -207,6 +288,19 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
   /// Maximum number of entries to evict at each operation if the index is over capacity
   static constexpr size_t EVICT_LIMIT = 64;
+
+  // ---- filter storage
+
+  /** \brief Time slices of filters, oldest first
+   *
+   *  Entries are added to the last filter of the last slice. The number of slices is
+   *  EXPECTED_MARK_COUNT + 1, so that an entry survives for at least EXPECTED_MARK_COUNT
+   *  mark intervals after the slice it was added to becomes inactive.
+   */
+  std::deque<std::vector<CuckooFilter>> m_slices;
+
+  /// Minimum number of buckets of a filter
+  static constexpr size_t MIN_FILTER_BUCKETS = 1 << 8;
 };
 
 } // namespace nfd
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -92,6 +92,7 @@ Fib::insert(const Name& prefix)
 
   nte.setFibEntry(make_unique<Entry>(prefix));
   ++m_nItems;
+  this->afterEntryChange(prefix);
   return {nte.getFibEntry(), true};
 }
 
@@ -100,11 +101,13 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 {
   BOOST_ASSERT(nte != nullptr);
 
+  Name prefix = nte->getName();
   nte->setFibEntry(nullptr);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
   }
   --m_nItems;
+  this->afterEntryChange(prefix);
 }
 
 void
@@ -133,6 +136,7 @@ Fib::addOrUpdateNextHop(Entry& entry, Face& face, uint64_t cost)
   auto [it, isNew] = entry.addOrUpdateNextHop(face, cost);
   if (isNew)
     this->afterNewNextHop(entry.getPrefix(), *it);
+  this->afterEntryChange(entry.getPrefix());
 }
 
 Fib::RemoveNextHopResult
@@ -149,6 +153,7 @@ Fib::removeNextHop(Entry& entry, const Face& face)
     return RemoveNextHopResult::FIB_ENTRY_REMOVED;
   }
   else {
+    this->afterEntryChange(entry.getPrefix());
     return RemoveNextHopResult::NEXTHOP_REMOVED;
   }
 }
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -153,6 +153,12 @@ public: // signal
    */
   signal::Signal<Fib, Name, NextHop> afterNewNextHop;
 
+  /** \brief Signals after a Fib entry is inserted, erased, or has its nexthops changed.
+   *
+   *  The argument is the entry prefix. Use findExactMatch to tell whether the entry still exists.
+   */
+  signal::Signal<Fib, Name> afterEntryChange;
+
 private:
   /** \tparam K a parameter acceptable to NameTree::findLongestPrefixMatch
    */
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -89,6 +89,37 @@ computeHashes(const Name& name, size_t prefixLen)
   return seq;
 }
 
+template<typename Packet>
+static const HashSequence&
+getOrComputeHashes(const Packet& pkt)
+{
+  const Name& name = pkt.getName();
+  const Block& wire = name.wireEncode();
+  auto tag = pkt.template getTag<HashSequenceTag>();
+  if (tag == nullptr || tag->get().nameWire.data() != wire.data() ||
+      tag->get().nameWire.size() != wire.size()) {
+    // either never computed, or the name has changed since the tag was attached
+    tag = make_shared<HashSequenceTag>(CachedHashSequence{wire, computeHashes(name)});
+    pkt.setTag(tag);
+  }
+
+  // recomputing the hashes here would defeat the cache even in debug builds
+  BOOST_ASSERT(tag->get().nameWire.data() == wire.data() && tag->get().nameWire.size() == wire.size());
+  return tag->get().hashes;
+}
+
+const HashSequence&
+getHashes(const Interest& interest)
+{
+  return getOrComputeHashes(interest);
+}
+
+const HashSequence&
+getHashes(const Data& data)
+{
+  return getOrComputeHashes(data);
+}
+
 Node::Node(HashValue h, const Name& name)
   : hash(h)
   , prev(nullptr)
@@ -109,6 +140,18 @@ getNode(const Entry& entry)
   return entry.m_node;
 }
 
+std::ostream&
+operator<<(std::ostream& os, HashtableLayout layout)
+{
+  switch (layout) {
+    case HashtableLayout::CHAINED:
+      return os << "chained";
+    case HashtableLayout::OPEN_ADDRESSING:
+      return os << "open-addressing";
+  }
+  return os << "unknown";
+}
+
 HashtableOptions::HashtableOptions(size_t size)
   : initialSize(size)
   , minSize(size)
@@ -117,6 +160,7 @@ HashtableOptions::HashtableOptions(size_t size)
 
 Hashtable::Hashtable(const Options& options)
   : m_options(options)
+  , m_isOpenAddressing(options.layout == HashtableLayout::OPEN_ADDRESSING)
   , m_size(0)
 {
   BOOST_ASSERT(m_options.minSize > 0);
@@ -129,20 +173,51 @@ Hashtable::Hashtable(const Options& options)
   BOOST_ASSERT(m_options.shrinkFactor > 0.0);
   BOOST_ASSERT(m_options.shrinkFactor < 1.0);
 
-  m_buckets.resize(options.initialSize);
+  if (m_isOpenAddressing) {
+    m_slots.resize(options.initialSize);
+  }
+  else {
+    m_buckets.resize(options.initialSize);
+  }
   this->computeThresholds();
 }
 
 Hashtable::~Hashtable()
 {
+  for (const Slot& slot : m_slots) {
+    if (slot.node != nullptr) {
+      this->destroyNode(slot.node);
+    }
+  }
+
   for (size_t i = 0; i < m_buckets.size(); ++i) {
-    foreachNode(m_buckets[i], [] (Node* node) {
+    foreachNode(m_buckets[i], [this] (Node* node) {
       node->prev = node->next = nullptr;
-      delete node;
+      this->destroyNode(node);
     });
   }
 }
 
+Node*
+Hashtable::createNode(HashValue h, const Name& name)
+{
+  void* mem = m_nodePool.allocate();
+  try {
+    return new (mem) Node(h, name);
+  }
+  catch (...) {
+    m_nodePool.deallocate(mem);
+    throw;
+  }
+}
+
+void
+Hashtable::destroyNode(Node* node) noexcept
+{
+  node->~Node();
+  m_nodePool.deallocate(node);
+}
+
 void
 Hashtable::attach(size_t bucket, Node* node)
 {
@@ -180,6 +255,10 @@ Hashtable::detach(size_t bucket, Node* node)
 std::pair<const Node*, bool>
 Hashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert)
 {
+  if (m_isOpenAddressing) {
+    return this->findOrInsertOpenAddressing(name, prefixLen, h, allowInsert);
+  }
+
   size_t bucket = this->computeBucketIndex(h);
 
   for (const Node* node = m_buckets[bucket]; node != nullptr; node = node->next) {
@@ -194,7 +273,7 @@ Hashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool al
     return {nullptr, false};
   }
 
-  Node* node = new Node(h, name.getPrefix(prefixLen));
+  Node* node = this->createNode(h, name.getPrefix(prefixLen));
   this->attach(bucket, node);
   NFD_LOG_TRACE("insert " << node->entry.getName() << " hash=" << h << " bucket=" << bucket);
   ++m_size;
@@ -206,6 +285,124 @@ Hashtable::findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool al
   return {node, true};
 }
 
+std::pair<const Node*, bool>
+Hashtable::findOrInsertOpenAddressing(const Name& name, size_t prefixLen, HashValue h,
+                                      bool allowInsert)
+{
+  size_t slot = this->computeBucketIndex(h);
+  size_t dist = 0;
+  for (;; slot = this->nextSlot(slot), ++dist) {
+    const Slot& cur = m_slots[slot];
+    // a slot closer to its home than we are to ours means the name cannot be further along
+    if (cur.node == nullptr || this->computeProbeDistance(cur.hash, slot) < dist) {
+      break;
+    }
+    if (cur.hash == h && name.compare(0, prefixLen, cur.node->entry.getName()) == 0) {
+      NFD_LOG_TRACE("found " << name.getPrefix(prefixLen) << " hash=" << h << " slot=" << slot);
+      return {cur.node, false};
+    }
+  }
+
+  if (!allowInsert) {
+    NFD_LOG_TRACE("not-found " << name.getPrefix(prefixLen) << " hash=" << h << " slot=" << slot);
+    return {nullptr, false};
+  }
+
+  Node* node = this->createNode(h, name.getPrefix(prefixLen));
+  NFD_LOG_TRACE("insert " << node->entry.getName() << " hash=" << h << " slot=" << slot);
+  ++m_size;
+
+  if (m_size > m_expandThreshold) {
+    // expand before placing the new node, so that the table never becomes full
+    this->resize(std::max(this->getNBuckets() + 1,
+                          static_cast<size_t>(m_options.expandFactor * this->getNBuckets())));
+    this->placeSlot({node, h}, this->computeBucketIndex(h), 0);
+  }
+  else {
+    this->placeSlot({node, h}, slot, dist);
+  }
+
+  return {node, true};
+}
+
+void
+Hashtable::placeSlot(Slot slot, size_t i, size_t dist)
+{
+  for (;; i = this->nextSlot(i), ++dist) {
+    Slot& cur = m_slots[i];
+    if (cur.node == nullptr) {
+      cur = slot;
+      return;
+    }
+
+    size_t curDist = this->computeProbeDistance(cur.hash, i);
+    if (curDist < dist) {
+      // the slot is taken from the node that is closer to its home, which continues probing
+      std::swap(cur, slot);
+      dist = curDist;
+    }
+  }
+}
+
+void
+Hashtable::removeSlot(size_t i)
+{
+  for (size_t next = this->nextSlot(i);
+       m_slots[next].node != nullptr && this->computeProbeDistance(m_slots[next].hash, next) > 0;
+       i = next, next = this->nextSlot(next)) {
+    m_slots[i] = m_slots[next];
+  }
+  m_slots[i] = Slot{};
+}
+
+// Asks the CPU to load the cache line containing addr; this never faults, even if addr is invalid.
+static void
+prefetch(const void* addr) noexcept
+{
+#if defined(__GNUC__)
+  __builtin_prefetch(addr);
+#else
+  (void)addr;
+#endif
+}
+
+void
+Hashtable::prefetchBucket(HashValue h) const noexcept
+{
+  size_t bucket = this->computeBucketIndex(h);
+  if (m_isOpenAddressing) {
+    prefetch(&m_slots[bucket]);
+  }
+  else {
+    prefetch(&m_buckets[bucket]);
+  }
+}
+
+void
+Hashtable::prefetchNode(HashValue h) const noexcept
+{
+  const Node* node = this->getBucket(this->computeBucketIndex(h));
+  if (node != nullptr) {
+    prefetch(node);
+  }
+}
+
+size_t
+Hashtable::findBucketIndex(const Node* node) const
+{
+  BOOST_ASSERT(node != nullptr);
+  if (!m_isOpenAddressing) {
+    return this->computeBucketIndex(node->hash);
+  }
+
+  size_t slot = this->computeBucketIndex(node->hash);
+  while (m_slots[slot].node != node) {
+    BOOST_ASSERT(m_slots[slot].node != nullptr);
+    slot = this->nextSlot(slot);
+  }
+  return slot;
+}
+
 const Node*
 Hashtable::find(const Name& name, size_t prefixLen) const
 {
@@ -233,11 +430,16 @@ Hashtable::erase(Node* node)
   BOOST_ASSERT(node != nullptr);
   BOOST_ASSERT(node->entry.getParent() == nullptr);
 
-  size_t bucket = this->computeBucketIndex(node->hash);
+  size_t bucket = this->findBucketIndex(node);
   NFD_LOG_TRACE("erase " << node->entry.getName() << " hash=" << node->hash << " bucket=" << bucket);
 
-  this->detach(bucket, node);
-  delete node;
+  if (m_isOpenAddressing) {
+    this->removeSlot(bucket);
+  }
+  else {
+    this->detach(bucket, node);
+  }
+  this->destroyNode(node);
   --m_size;
 
   if (m_size < m_shrinkThreshold) {
@@ -251,6 +453,10 @@ void
 Hashtable::computeThresholds()
 {
   m_expandThreshold = static_cast<size_t>(m_options.expandLoadFactor * this->getNBuckets());
+  if (m_isOpenAddressing) {
+    // at least one slot must stay empty for probing to terminate
+    m_expandThreshold = std::min(m_expandThreshold, this->getNBuckets() - 1);
+  }
   m_shrinkThreshold = static_cast<size_t>(m_options.shrinkLoadFactor * this->getNBuckets());
   NFD_LOG_TRACE("thresholds expand=" << m_expandThreshold << " shrink=" << m_shrinkThreshold);
 }
@@ -258,11 +464,28 @@ Hashtable::computeThresholds()
 void
 Hashtable::resize(size_t newNBuckets)
 {
+  if (m_isOpenAddressing) {
+    // every node needs its own slot, plus one empty slot to terminate probing
+    newNBuckets = std::max(newNBuckets, m_size + 1);
+  }
+
   if (this->getNBuckets() == newNBuckets) {
     return;
   }
   NFD_LOG_DEBUG("resize from=" << this->getNBuckets() << " to=" << newNBuckets);
 
+  if (m_isOpenAddressing) {
+    std::vector<Slot> oldSlots(newNBuckets);
+    oldSlots.swap(m_slots);
+    for (const Slot& slot : oldSlots) {
+      if (slot.node != nullptr) {
+        this->placeSlot(slot, this->computeBucketIndex(slot.hash), 0);
+      }
+    }
+    this->computeThresholds();
+    return;
+  }
+
   std::vector<Node*> oldBuckets;
   oldBuckets.swap(m_buckets);
   m_buckets.resize(newNBuckets);
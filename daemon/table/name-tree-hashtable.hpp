@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -27,6 +27,9 @@
 #define NFD_DAEMON_TABLE_NAME_TREE_HASHTABLE_HPP
 
 #include "name-tree-entry.hpp"
+#include "common/memory-pool.hpp"
+
+#include <ndn-cxx/tag.hpp>
 
 #include <limits>
 
@@ -54,6 +57,41 @@ computeHash(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::ma
 HashSequence
 computeHashes(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max());
 
+/** \brief The hash sequence of a name, together with the name it was computed from.
+ *
+ *  \p nameWire holds a reference to the buffer of the name's encoding, so that the buffer
+ *  cannot be freed and reused while the hashes are cached. Comparing its address with that
+ *  of the packet's current name therefore tells whether the name has changed.
+ */
+struct CachedHashSequence
+{
+  Block nameWire;
+  HashSequence hashes;
+};
+
+/** \brief A packet tag that caches the hash sequence of the packet's name.
+ *  \sa getHashes
+ */
+using HashSequenceTag = ndn::SimpleTag<CachedHashSequence, 21>;
+
+/** \brief Returns the hash sequence of \p interest's name.
+ *
+ *  The hash sequence is computed on first use and cached on \p interest as a HashSequenceTag,
+ *  so that the name is hashed only once, no matter how many table lookups are performed on it
+ *  by the forwarding pipelines.
+ *
+ *  \return computeHashes(interest.getName())
+ *  \warning The returned reference is invalidated if the tag is removed from \p interest.
+ */
+const HashSequence&
+getHashes(const Interest& interest);
+
+/** \brief Returns the hash sequence of \p data's name.
+ *  \sa getHashes(const Interest&)
+ */
+const HashSequence&
+getHashes(const Data& data);
+
 /** \brief A hashtable node.
  *
  *  Zero or more nodes can be added to a hashtable bucket. They are organized as
@@ -102,6 +140,20 @@ foreachNode(N* head, const F& func)
   }
 }
 
+/**
+ * \brief Indicates how Hashtable organizes its nodes.
+ */
+enum class HashtableLayout {
+  /// Each bucket holds a doubly linked list of nodes.
+  CHAINED,
+  /// Each bucket holds at most one node, stored inline together with its hash value.
+  /// Collisions are resolved through Robin Hood linear probing.
+  OPEN_ADDRESSING,
+};
+
+std::ostream&
+operator<<(std::ostream& os, HashtableLayout layout);
+
 /**
  * \brief Provides options for Hashtable.
  */
@@ -137,6 +189,10 @@ struct HashtableOptions
   /** \brief When the hashtable is shrunk, its new size will be `max(nBuckets*shrinkFactor, minSize)`.
    */
   float shrinkFactor = 0.5f;
+
+  /** \brief How nodes are organized in buckets.
+   */
+  HashtableLayout layout = HashtableLayout::CHAINED;
 };
 
 /**
@@ -144,8 +200,13 @@ struct HashtableOptions
  *
  * The Hashtable contains a number of buckets.
  * Each node is placed into a bucket determined by a hash value computed from its name.
- * Hash collision is resolved through a doubly linked list in each bucket.
+ * With HashtableLayout::CHAINED, hash collision is resolved through a doubly linked list
+ * in each bucket. With HashtableLayout::OPEN_ADDRESSING, each bucket is a slot in a flat
+ * array holding the hash value and a pointer to at most one node, and hash collision is
+ * resolved through Robin Hood linear probing, so that a lookup touches a few adjacent
+ * slots instead of following a chain of nodes.
  * The number of buckets is adjusted according to how many nodes are stored.
+ * Nodes are allocated from a per-hashtable FixedSizePool.
  */
 class Hashtable
 {
@@ -172,7 +233,7 @@ public:
   size_t
   getNBuckets() const
   {
-    return m_buckets.size();
+    return m_isOpenAddressing ? m_slots.size() : m_buckets.size();
   }
 
   /** \return bucket index for hash value h
@@ -190,9 +251,17 @@ public:
   getBucket(size_t bucket) const
   {
     BOOST_ASSERT(bucket < this->getNBuckets());
-    return m_buckets[bucket]; // don't use m_bucket.at() for better performance
+    // don't use .at() for better performance
+    return m_isOpenAddressing ? m_slots[bucket].node : m_buckets[bucket];
   }
 
+  /** \return index of the bucket that contains \p node
+   *  \pre node exists in this hashtable
+   *  \note With HashtableLayout::OPEN_ADDRESSING, this may differ from computeBucketIndex(node->hash).
+   */
+  size_t
+  findBucketIndex(const Node* node) const;
+
   /** \brief Find node for name.getPrefix(prefixLen).
    *  \pre name.size() > prefixLen
    */
@@ -219,6 +288,20 @@ public:
   void
   erase(Node* node);
 
+  /** \brief Hints that the bucket for hash value \p h will be accessed soon.
+   *
+   *  This only issues a prefetch instruction, so that the bucket can be loaded into the cache
+   *  while other work is being done. It does not access the bucket and never changes the table.
+   */
+  void
+  prefetchBucket(HashValue h) const noexcept;
+
+  /** \brief Hints that the first node in the bucket for hash value \p h will be accessed soon.
+   *  \note This reads the bucket, which should have been prefetched with prefetchBucket() earlier.
+   */
+  void
+  prefetchNode(HashValue h) const noexcept;
+
 private:
   /** \brief Attach node to bucket.
    */
@@ -230,9 +313,55 @@ private:
   void
   detach(size_t bucket, Node* node);
 
+  /** \brief Allocate and construct a node from the node pool.
+   */
+  Node*
+  createNode(HashValue h, const Name& name);
+
+  /** \brief Destruct a node and return it to the node pool.
+   */
+  void
+  destroyNode(Node* node) noexcept;
+
   std::pair<const Node*, bool>
   findOrInsert(const Name& name, size_t prefixLen, HashValue h, bool allowInsert);
 
+  std::pair<const Node*, bool>
+  findOrInsertOpenAddressing(const Name& name, size_t prefixLen, HashValue h, bool allowInsert);
+
+  /** \brief An open addressing slot.
+   */
+  struct Slot
+  {
+    Node* node = nullptr;
+    HashValue hash = 0;
+  };
+
+  /** \return distance between slot \p i and the home slot of hash value \p h
+   */
+  size_t
+  computeProbeDistance(HashValue h, size_t i) const
+  {
+    size_t home = this->computeBucketIndex(h);
+    return i >= home ? i - home : i + m_slots.size() - home;
+  }
+
+  size_t
+  nextSlot(size_t i) const
+  {
+    return i + 1 == m_slots.size() ? 0 : i + 1;
+  }
+
+  /** \brief Place \p slot into the table, starting at slot \p i whose probe distance is \p dist.
+   */
+  void
+  placeSlot(Slot slot, size_t i, size_t dist);
+
+  /** \brief Remove the node in slot \p i, shifting subsequent displaced slots backward.
+   */
+  void
+  removeSlot(size_t i);
+
   void
   computeThresholds();
 
@@ -240,8 +369,11 @@ private:
   resize(size_t newNBuckets);
 
 private:
-  std::vector<Node*> m_buckets;
+  FixedSizePool m_nodePool{sizeof(Node)};
+  std::vector<Node*> m_buckets; ///< used with HashtableLayout::CHAINED
+  std::vector<Slot> m_slots; ///< used with HashtableLayout::OPEN_ADDRESSING
   Options m_options;
+  bool m_isOpenAddressing;
   size_t m_size;
   size_t m_expandThreshold;
   size_t m_shrinkThreshold;
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -39,14 +39,26 @@ NameTree::NameTree(size_t nBuckets)
 {
 }
 
+NameTree::NameTree(const HashtableOptions& options)
+  : m_ht(options)
+{
+}
+
 Entry&
 NameTree::lookup(const Name& name, size_t prefixLen)
+{
+  BOOST_ASSERT(prefixLen <= name.size());
+  return this->lookup(name, prefixLen, computeHashes(name, prefixLen));
+}
+
+Entry&
+NameTree::lookup(const Name& name, size_t prefixLen, const HashSequence& hashes)
 {
   NFD_LOG_TRACE("lookup(" << name << ", " << prefixLen << ')');
   BOOST_ASSERT(prefixLen <= name.size());
   BOOST_ASSERT(prefixLen <= getMaxDepth());
+  BOOST_ASSERT(hashes.size() > prefixLen);
 
-  HashSequence hashes = computeHashes(name, prefixLen);
   const Node* node = nullptr;
   Entry* parent = nullptr;
 
@@ -145,6 +157,75 @@ NameTree::eraseIfEmpty(Entry* entry, bool canEraseAncestors)
   return nErased;
 }
 
+static std::vector<HashSequence>
+computeBatchHashes(span<const Name> names)
+{
+  std::vector<HashSequence> hashes;
+  hashes.reserve(names.size());
+  for (const Name& name : names) {
+    hashes.push_back(computeHashes(name, std::min(name.size(), NameTree::getMaxDepth())));
+  }
+  return hashes;
+}
+
+// Invokes func(i) for each name, prefetching buckets two names ahead and nodes one name ahead,
+// so that the memory accesses for the next names overlap with the work on the current one.
+template<typename F>
+static void
+forEachPipelined(const NameTree& nt, const std::vector<HashSequence>& hashes, const F& func)
+{
+  size_t n = hashes.size();
+  if (n > 0) {
+    nt.prefetchBuckets(hashes[0]);
+  }
+  if (n > 1) {
+    nt.prefetchBuckets(hashes[1]);
+  }
+  if (n > 0) {
+    nt.prefetchNodes(hashes[0]);
+  }
+
+  for (size_t i = 0; i < n; ++i) {
+    if (i + 2 < n) {
+      nt.prefetchBuckets(hashes[i + 2]);
+    }
+    if (i + 1 < n) {
+      nt.prefetchNodes(hashes[i + 1]);
+    }
+    func(i);
+  }
+}
+
+std::vector<Entry*>
+NameTree::lookupBatch(span<const Name> names)
+{
+  auto hashes = computeBatchHashes(names);
+  std::vector<Entry*> entries;
+  entries.reserve(names.size());
+  forEachPipelined(*this, hashes, [&] (size_t i) {
+    entries.push_back(&this->lookup(names[i], hashes[i].size() - 1, hashes[i]));
+  });
+  return entries;
+}
+
+void
+NameTree::prefetchBuckets(const HashSequence& hashes, size_t prefixLen) const noexcept
+{
+  size_t end = std::min({prefixLen + 1, hashes.size(), getMaxDepth() + 1});
+  for (size_t i = 0; i < end; ++i) {
+    m_ht.prefetchBucket(hashes[i]);
+  }
+}
+
+void
+NameTree::prefetchNodes(const HashSequence& hashes, size_t prefixLen) const noexcept
+{
+  size_t end = std::min({prefixLen + 1, hashes.size(), getMaxDepth() + 1});
+  for (size_t i = 0; i < end; ++i) {
+    m_ht.prefetchNode(hashes[i]);
+  }
+}
+
 Entry*
 NameTree::findExactMatch(const Name& name, size_t prefixLen) const
 {
@@ -157,11 +238,31 @@ NameTree::findExactMatch(const Name& name, size_t prefixLen) const
   return node == nullptr ? nullptr : &node->entry;
 }
 
+Entry*
+NameTree::findExactMatch(const Name& name, size_t prefixLen, const HashSequence& hashes) const
+{
+  prefixLen = std::min(name.size(), prefixLen);
+  if (prefixLen > getMaxDepth()) {
+    return nullptr;
+  }
+
+  const Node* node = m_ht.find(name, prefixLen, hashes);
+  return node == nullptr ? nullptr : &node->entry;
+}
+
 Entry*
 NameTree::findLongestPrefixMatch(const Name& name, const EntrySelector& entrySelector) const
 {
   size_t depth = std::min(name.size(), getMaxDepth());
-  HashSequence hashes = computeHashes(name, depth);
+  return this->findLongestPrefixMatch(name, computeHashes(name, depth), entrySelector);
+}
+
+Entry*
+NameTree::findLongestPrefixMatch(const Name& name, const HashSequence& hashes,
+                                 const EntrySelector& entrySelector) const
+{
+  size_t depth = std::min(name.size(), getMaxDepth());
+  BOOST_ASSERT(hashes.size() > depth);
 
   for (ssize_t i = depth; i >= 0; --i) {
     const Node* node = m_ht.find(name, i, hashes);
@@ -173,6 +274,18 @@ NameTree::findLongestPrefixMatch(const Name& name, const EntrySelector& entrySel
   return nullptr;
 }
 
+std::vector<Entry*>
+NameTree::findLongestPrefixMatchBatch(span<const Name> names, const EntrySelector& entrySelector) const
+{
+  auto hashes = computeBatchHashes(names);
+  std::vector<Entry*> entries;
+  entries.reserve(names.size());
+  forEachPipelined(*this, hashes, [&] (size_t i) {
+    entries.push_back(this->findLongestPrefixMatch(names[i], hashes[i], entrySelector));
+  });
+  return entries;
+}
+
 Entry*
 NameTree::findLongestPrefixMatch(const Entry& entry1, const EntrySelector& entrySelector) const
 {
@@ -196,8 +309,9 @@ NameTree::findLongestPrefixMatch(const pit::Entry& pitEntry, const EntrySelector
   size_t depth = std::min(name.size(), getMaxDepth());
   if (nte->getName().size() < pitEntry.getName().size()) {
     // PIT entry name either exceeds depth limit or ends with an implicit digest: go deeper
+    const HashSequence& hashes = getHashes(pitEntry.getInterest());
     for (size_t i = nte->getName().size() + 1; i <= depth; ++i) {
-      const Entry* exact = this->findExactMatch(name, i);
+      const Entry* exact = this->findExactMatch(name, i, hashes);
       if (exact == nullptr) {
         break;
       }
@@ -221,6 +335,14 @@ NameTree::findAllMatches(const Name& name, const EntrySelector& entrySelector) c
   return {Iterator(make_shared<PrefixMatchImpl>(*this, entrySelector), entry), end()};
 }
 
+boost::iterator_range<NameTree::const_iterator>
+NameTree::findAllMatches(const Name& name, const HashSequence& hashes,
+                         const EntrySelector& entrySelector) const
+{
+  Entry* entry = this->findLongestPrefixMatch(name, hashes, entrySelector);
+  return {Iterator(make_shared<PrefixMatchImpl>(*this, entrySelector), entry), end()};
+}
+
 boost::iterator_range<NameTree::const_iterator>
 NameTree::fullEnumerate(const EntrySelector& entrySelector) const
 {
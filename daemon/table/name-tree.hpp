@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2019,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -39,6 +39,9 @@ public:
   explicit
   NameTree(size_t nBuckets = 1024);
 
+  explicit
+  NameTree(const HashtableOptions& options);
+
 public: // information
   /** \brief Maximum depth of the name tree
    *
@@ -92,6 +95,15 @@ public: // mutation
   Entry&
   lookup(const Name& name, size_t prefixLen);
 
+  /** \brief Equivalent to `lookup(name, prefixLen)`, using precomputed hash values
+   *  \param hashes hash values of the prefixes of \p name; it must contain at least
+   *                the first `prefixLen + 1` elements of `computeHashes(name)`
+   *  \note This overload avoids rehashing \p name when its hash values are already known,
+   *        e.g., from getHashes(const Interest&).
+   */
+  Entry&
+  lookup(const Name& name, size_t prefixLen, const HashSequence& hashes);
+
   /** \brief Equivalent to `lookup(name, name.size())`
    */
   Entry&
@@ -141,6 +153,38 @@ public: // mutation
   size_t
   eraseIfEmpty(Entry* entry, bool canEraseAncestors = true);
 
+  /** \brief Find or insert entries for several names
+   *
+   *  Each name is truncated to \c getMaxDepth() components, as in \c lookup(const pit::Entry&).
+   *  The hash values of all names are computed first, and the hashtable is accessed in a
+   *  software pipeline: while a name is being looked up, the buckets and nodes needed by the
+   *  next names are being prefetched.
+   *
+   *  \return entries in the same order as \p names
+   */
+  std::vector<Entry*>
+  lookupBatch(span<const Name> names);
+
+public: // prefetching
+  /** \brief Prefetches the hashtable buckets for prefixes of a name
+   *  \param hashes hash values of the prefixes of a name, e.g., from getHashes(const Interest&)
+   *  \param prefixLen longest prefix to prefetch; prefixes longer than \c getMaxDepth() are skipped
+   *
+   *  This is the first stage of a software pipeline over several names: it should be called
+   *  for a name well before that name is looked up, followed by prefetchNodes() later.
+   */
+  void
+  prefetchBuckets(const HashSequence& hashes,
+                  size_t prefixLen = std::numeric_limits<size_t>::max()) const noexcept;
+
+  /** \brief Prefetches the first hashtable node in the buckets for prefixes of a name
+   *  \pre prefetchBuckets() has been called with the same arguments, preferably a while ago
+   *  \sa prefetchBuckets()
+   */
+  void
+  prefetchNodes(const HashSequence& hashes,
+                size_t prefixLen = std::numeric_limits<size_t>::max()) const noexcept;
+
 public: // matching
   /** \brief Exact match lookup
    *  \return entry with \c name.getPrefix(prefixLen), or nullptr if it does not exist
@@ -148,6 +192,14 @@ public: // matching
   Entry*
   findExactMatch(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max()) const;
 
+  /** \brief Exact match lookup, using precomputed hash values
+   *  \param hashes hash values of the prefixes of \p name; it must contain at least
+   *                the first `min(prefixLen, name.size()) + 1` elements of `computeHashes(name)`
+   *  \return entry with \c name.getPrefix(prefixLen), or nullptr if it does not exist
+   */
+  Entry*
+  findExactMatch(const Name& name, size_t prefixLen, const HashSequence& hashes) const;
+
   /** \brief Longest prefix matching
    *  \return entry whose name is a prefix of \p name and passes \p entrySelector,
    *          where no other entry with a longer name satisfies those requirements;
@@ -157,6 +209,26 @@ public: // matching
   findLongestPrefixMatch(const Name& name,
                          const EntrySelector& entrySelector = AnyEntry()) const;
 
+  /** \brief Longest prefix matching, using precomputed hash values
+   *  \param hashes hash values of the prefixes of \p name; it must contain at least
+   *                the first `min(name.size(), getMaxDepth()) + 1` elements of `computeHashes(name)`
+   *  \sa findLongestPrefixMatch(const Name&, const EntrySelector&)
+   */
+  Entry*
+  findLongestPrefixMatch(const Name& name, const HashSequence& hashes,
+                         const EntrySelector& entrySelector = AnyEntry()) const;
+
+  /** \brief Longest prefix matching for several names
+   *
+   *  This is equivalent to calling \c findLongestPrefixMatch(name, entrySelector) for each name,
+   *  but the hashtable is accessed in a software pipeline, see lookupBatch().
+   *
+   *  \return matched entries or nullptr, in the same order as \p names
+   */
+  std::vector<Entry*>
+  findLongestPrefixMatchBatch(span<const Name> names,
+                              const EntrySelector& entrySelector = AnyEntry()) const;
+
   /** \brief Equivalent to `findLongestPrefixMatch(entry.getName(), entrySelector)`
    *  \note This overload is more efficient than
    *        `findLongestPrefixMatch(const Name&, const EntrySelector&)` in common cases.
@@ -213,6 +285,14 @@ public: // matching
   findAllMatches(const Name& name,
                  const EntrySelector& entrySelector = AnyEntry()) const;
 
+  /** \brief All-prefixes match lookup, using precomputed hash values
+   *  \param hashes hash values of the prefixes of \p name, see findLongestPrefixMatch()
+   *  \sa findAllMatches(const Name&, const EntrySelector&)
+   */
+  Range
+  findAllMatches(const Name& name, const HashSequence& hashes,
+                 const EntrySelector& entrySelector = AnyEntry()) const;
+
 public: // enumeration
   using const_iterator = Iterator;
 
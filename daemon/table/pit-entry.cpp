@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -59,8 +59,10 @@ OutRecord::setIncomingNack(const lp::Nack& nack)
   return true;
 }
 
-Entry::Entry(const Interest& interest)
+Entry::Entry(const Interest& interest, shared_ptr<MemoryPool> pool)
   : m_interest(interest.shared_from_this())
+  , m_inRecords(PoolAllocator<InRecord>(pool))
+  , m_outRecords(PoolAllocator<OutRecord>(std::move(pool)))
 {
 }
 
@@ -91,8 +93,7 @@ Entry::insertOrUpdateInRecord(Face& face, const Interest& interest)
 
   auto it = findInRecord(face);
   if (it == m_inRecords.end()) {
-    m_inRecords.emplace_front(face);
-    it = m_inRecords.begin();
+    it = m_inRecords.emplace(face);
   }
 
   it->update(interest);
@@ -113,8 +114,7 @@ Entry::insertOrUpdateOutRecord(Face& face, const Interest& interest)
 
   auto it = findOutRecord(face);
   if (it == m_outRecords.end()) {
-    m_outRecords.emplace_front(face);
-    it = m_outRecords.begin();
+    it = m_outRecords.emplace(face);
   }
 
   it->update(interest);
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,11 +26,10 @@
 #ifndef NFD_DAEMON_TABLE_PIT_ENTRY_HPP
 #define NFD_DAEMON_TABLE_PIT_ENTRY_HPP
 
+#include "pit-record-collection.hpp"
 #include "strategy-info-host.hpp"
-
-#include <ndn-cxx/util/scheduler.hpp>
-
-#include <list>
+#include "common/memory-pool.hpp"
+#include "common/timer-wheel.hpp"
 
 namespace nfd {
 
@@ -175,12 +174,12 @@ private:
 /**
  * \brief An unordered collection of in-records.
  */
-using InRecordCollection = std::list<InRecord>;
+using InRecordCollection = RecordCollection<InRecord, 2, PoolAllocator<InRecord>>;
 
 /**
  * \brief An unordered collection of out-records.
  */
-using OutRecordCollection = std::list<OutRecord>;
+using OutRecordCollection = RecordCollection<OutRecord, 2, PoolAllocator<OutRecord>>;
 
 /**
  * \brief Represents an entry in the %Interest table (PIT).
@@ -196,8 +195,13 @@ using OutRecordCollection = std::list<OutRecord>;
 class Entry : public StrategyInfoHost, noncopyable
 {
 public:
+  /**
+   * \param interest the representative Interest
+   * \param pool memory pool for in-records and out-records beyond the inline capacity;
+   *             if null, the system allocator is used
+   */
   explicit
-  Entry(const Interest& interest);
+  Entry(const Interest& interest, shared_ptr<MemoryPool> pool = nullptr);
 
   /** \return the representative Interest of the PIT entry
    *  \note Every Interest in in-records and out-records should have same Name and Selectors
@@ -372,9 +376,10 @@ public: // out-record
 public:
   /** \brief Expiry timer.
    *
-   *  This timer is used in forwarding pipelines to delete the entry
+   *  This timer is armed on the forwarder's TimerWheel in forwarding pipelines
+   *  to delete the entry.
    */
-  ndn::scheduler::EventId expiryTimer;
+  TimerWheel::Timer expiryTimer;
 
   /** \brief Indicates whether this PIT entry is satisfied.
    */
@@ -385,6 +390,13 @@ public:
    */
   time::milliseconds dataFreshnessPeriod = 0_ms;
 
+  /** \brief Indicates whether the Content Store lookup for this entry continues in the
+   *         disk tier of the Content Store.
+   *
+   *  While it is true, Interests aggregated into this entry wait for the lookup to complete.
+   */
+  bool hasPendingCsLookup = false;
+
 private:
   shared_ptr<const Interest> m_interest;
   InRecordCollection m_inRecords;
@@ -0,0 +1,355 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_RECORD_COLLECTION_HPP
+#define NFD_DAEMON_TABLE_PIT_RECORD_COLLECTION_HPP
+
+#include "core/common.hpp"
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+
+namespace nfd::pit {
+
+/**
+ * \brief An unordered collection of face records with inline storage.
+ *
+ * The first \p N records are stored inside the collection object itself, so that the common
+ * case of a PIT entry with one or two in-records or out-records needs no allocation, and
+ * iterating over the records touches contiguous memory. Additional records are allocated
+ * individually through \p Allocator.
+ *
+ * Records are never moved or copied once constructed: as with std::list, pointers, references,
+ * and iterators to a record remain valid until that record is erased, so that strategies may
+ * keep handles to records while other records are inserted or erased.
+ *
+ * \tparam T record type, which needs not be copyable, movable, or assignable
+ * \tparam N inline capacity
+ * \tparam Allocator allocator for records beyond the inline capacity
+ */
+template<typename T, size_t N, typename Allocator = std::allocator<T>>
+class RecordCollection : noncopyable
+{
+private:
+  static_assert(N > 0);
+
+  using AllocTraits = std::allocator_traits<Allocator>;
+  using SpillAllocator = typename AllocTraits::template rebind_alloc<T*>;
+
+  static constexpr size_t NPOS = std::numeric_limits<size_t>::max();
+
+  template<bool IsConst>
+  class Iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<IsConst, const T*, T*>;
+    using reference = std::conditional_t<IsConst, const T&, T&>;
+    using Collection = std::conditional_t<IsConst, const RecordCollection, RecordCollection>;
+
+    Iterator() noexcept = default;
+
+    Iterator(Collection* coll, size_t pos) noexcept
+      : m_coll(coll)
+      , m_pos(pos)
+    {
+    }
+
+    /// Converts an iterator to a const_iterator.
+    template<bool IsConst2, typename = std::enable_if_t<IsConst && !IsConst2>>
+    Iterator(const Iterator<IsConst2>& other) noexcept
+      : m_coll(other.m_coll)
+      , m_pos(other.m_pos)
+    {
+    }
+
+    reference
+    operator*() const
+    {
+      return *m_coll->getSlot(m_pos);
+    }
+
+    pointer
+    operator->() const
+    {
+      return m_coll->getSlot(m_pos);
+    }
+
+    Iterator&
+    operator++()
+    {
+      m_pos = m_coll->findOccupied(m_pos + 1);
+      return *this;
+    }
+
+    Iterator
+    operator++(int)
+    {
+      Iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    friend bool
+    operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+      // all end iterators compare equal, like std::list::end() they are never invalidated
+      return lhs.m_pos == rhs.m_pos && (lhs.m_pos == NPOS || lhs.m_coll == rhs.m_coll);
+    }
+
+    friend bool
+    operator!=(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    Collection* m_coll = nullptr;
+    size_t m_pos = NPOS;
+
+    friend RecordCollection;
+    template<bool> friend class Iterator;
+  };
+
+public:
+  using value_type = T;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using iterator = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  explicit
+  RecordCollection(const Allocator& alloc = Allocator())
+    : m_alloc(alloc)
+    , m_spill(SpillAllocator(alloc))
+  {
+  }
+
+  ~RecordCollection()
+  {
+    this->clear();
+  }
+
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  bool
+  empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * \brief Returns the first record in iteration order.
+   * \pre !empty()
+   */
+  T&
+  front()
+  {
+    BOOST_ASSERT(!this->empty());
+    return *this->begin();
+  }
+
+  const T&
+  front() const
+  {
+    BOOST_ASSERT(!this->empty());
+    return *this->begin();
+  }
+
+  iterator
+  begin() noexcept
+  {
+    return {this, this->findOccupied(0)};
+  }
+
+  const_iterator
+  begin() const noexcept
+  {
+    return {this, this->findOccupied(0)};
+  }
+
+  iterator
+  end() noexcept
+  {
+    return {this, NPOS};
+  }
+
+  const_iterator
+  end() const noexcept
+  {
+    return {this, NPOS};
+  }
+
+  /**
+   * \brief Constructs a record in place.
+   * \return an iterator to the new record
+   */
+  template<typename... Args>
+  iterator
+  emplace(Args&&... args)
+  {
+    for (size_t i = 0; i < N; ++i) {
+      if (m_inline[i] == nullptr) {
+        m_inline[i] = new (&m_storage[i]) T(std::forward<Args>(args)...);
+        ++m_size;
+        return {this, i};
+      }
+    }
+
+    // inline storage is full, spill into a separately allocated record
+    T* record = AllocTraits::allocate(m_alloc, 1);
+    try {
+      AllocTraits::construct(m_alloc, record, std::forward<Args>(args)...);
+    }
+    catch (...) {
+      AllocTraits::deallocate(m_alloc, record, 1);
+      throw;
+    }
+
+    auto hole = std::find(m_spill.begin(), m_spill.end(), nullptr);
+    if (hole == m_spill.end()) {
+      try {
+        hole = m_spill.insert(m_spill.end(), record);
+      }
+      catch (...) {
+        this->destroySpilled(record);
+        throw;
+      }
+    }
+    else {
+      *hole = record;
+    }
+    ++m_size;
+    return {this, N + static_cast<size_t>(hole - m_spill.begin())};
+  }
+
+  /**
+   * \brief Erases the record at \p pos.
+   * \pre \p pos is valid and dereferenceable
+   * \note Iterators to other records are unaffected.
+   */
+  void
+  erase(const_iterator pos)
+  {
+    BOOST_ASSERT(pos.m_coll == this);
+    BOOST_ASSERT(pos.m_pos != NPOS);
+
+    if (pos.m_pos < N) {
+      m_inline[pos.m_pos]->~T();
+      m_inline[pos.m_pos] = nullptr;
+    }
+    else {
+      T*& record = m_spill[pos.m_pos - N];
+      this->destroySpilled(record);
+      record = nullptr;
+    }
+    --m_size;
+
+    // release spill slots at the tail
+    while (!m_spill.empty() && m_spill.back() == nullptr) {
+      m_spill.pop_back();
+    }
+  }
+
+  /**
+   * \brief Erases all records.
+   */
+  void
+  clear() noexcept
+  {
+    for (T*& record : m_inline) {
+      if (record != nullptr) {
+        record->~T();
+        record = nullptr;
+      }
+    }
+    for (T* record : m_spill) {
+      if (record != nullptr) {
+        this->destroySpilled(record);
+      }
+    }
+    m_spill.clear();
+    m_size = 0;
+  }
+
+private:
+  T*
+  getSlot(size_t pos) const noexcept
+  {
+    BOOST_ASSERT(pos != NPOS);
+    T* record = pos < N ? m_inline[pos] : m_spill[pos - N];
+    BOOST_ASSERT(record != nullptr);
+    return record;
+  }
+
+  /** \return position of the first record at or after \p pos, or NPOS if none
+   */
+  size_t
+  findOccupied(size_t pos) const noexcept
+  {
+    for (; pos < N; ++pos) {
+      if (m_inline[pos] != nullptr) {
+        return pos;
+      }
+    }
+    for (; pos - N < m_spill.size(); ++pos) {
+      if (m_spill[pos - N] != nullptr) {
+        return pos;
+      }
+    }
+    return NPOS;
+  }
+
+  void
+  destroySpilled(T* record) noexcept
+  {
+    AllocTraits::destroy(m_alloc, record);
+    AllocTraits::deallocate(m_alloc, record, 1);
+  }
+
+private:
+  struct alignas(T) Storage
+  {
+    std::byte bytes[sizeof(T)];
+  };
+
+  std::array<Storage, N> m_storage;
+  std::array<T*, N> m_inline{}; ///< m_inline[i] points to m_storage[i] if occupied, otherwise null
+  Allocator m_alloc;
+  std::vector<T*, SpillAllocator> m_spill;
+  size_t m_size = 0;
+};
+
+} // namespace nfd::pit
+
+#endif // NFD_DAEMON_TABLE_PIT_RECORD_COLLECTION_HPP
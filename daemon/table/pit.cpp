@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -56,12 +56,13 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
   nteDepth = std::min(nteDepth, NameTree::getMaxDepth());
 
   // ensure NameTree entry exists
+  const auto& hashes = name_tree::getHashes(interest);
   name_tree::Entry* nte = nullptr;
   if (allowInsert) {
-    nte = &m_nameTree.lookup(name, nteDepth);
+    nte = &m_nameTree.lookup(name, nteDepth, hashes);
   }
   else {
-    nte = m_nameTree.findExactMatch(name, nteDepth);
+    nte = m_nameTree.findExactMatch(name, nteDepth, hashes);
     if (nte == nullptr) {
       return {nullptr, true};
     }
@@ -83,7 +84,7 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
     return {nullptr, true};
   }
 
-  auto entry = make_shared<Entry>(interest);
+  auto entry = std::allocate_shared<Entry>(PoolAllocator<Entry>(m_pool), interest, m_pool);
   nte->insertPitEntry(entry);
   ++m_nItems;
   return {entry, true};
@@ -98,7 +99,8 @@ nteHasPitEntries(const name_tree::Entry& nte)
 DataMatchResult
 Pit::findAllDataMatches(const Data& data) const
 {
-  auto&& ntMatches = m_nameTree.findAllMatches(data.getName(), &nteHasPitEntries);
+  auto&& ntMatches = m_nameTree.findAllMatches(data.getName(), name_tree::getHashes(data),
+                                               &nteHasPitEntries);
 
   DataMatchResult matches;
   for (const auto& nte : ntMatches) {
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -80,6 +80,10 @@ private:
 
 /**
  * \brief NFD's Interest Table.
+ *
+ * PIT entries, together with their in-records and out-records, are allocated from a
+ * per-table MemoryPool, so that steady-state forwarding does not call the system allocator
+ * for them.
  */
 class Pit : noncopyable
 {
@@ -173,6 +177,7 @@ private:
 
 private:
   NameTree& m_nameTree;
+  shared_ptr<MemoryPool> m_pool = make_shared<MemoryPool>();
   size_t m_nItems = 0;
 };
 
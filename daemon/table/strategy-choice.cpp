@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -188,6 +188,16 @@ StrategyChoice::findEffectiveStrategy(const Name& prefix) const
   return this->findEffectiveStrategyImpl(prefix);
 }
 
+Strategy&
+StrategyChoice::findEffectiveStrategy(const Interest& interest) const
+{
+  const name_tree::Entry* nte = m_nameTree.findLongestPrefixMatch(interest.getName(),
+                                                                  name_tree::getHashes(interest),
+                                                                  &nteHasStrategyChoiceEntry);
+  BOOST_ASSERT(nte != nullptr);
+  return nte->getStrategyChoiceEntry()->getStrategy();
+}
+
 Strategy&
 StrategyChoice::findEffectiveStrategy(const pit::Entry& pitEntry) const
 {
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -137,6 +137,14 @@ public: // effective strategy
   fw::Strategy&
   findEffectiveStrategy(const Name& prefix) const;
 
+  /** \brief Get effective strategy for \p interest
+   *
+   *  This is equivalent to `findEffectiveStrategy(interest.getName())`, but reuses the
+   *  name hashes cached on \p interest.
+   */
+  fw::Strategy&
+  findEffectiveStrategy(const Interest& interest) const;
+
   /** \brief Get effective strategy for \p pitEntry
    *
    *  This is equivalent to `findEffectiveStrategy(pitEntry.getName())`
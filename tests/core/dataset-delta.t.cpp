@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "core/dataset-delta.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(TestDatasetDelta)
+
+BOOST_AUTO_TEST_CASE(Header)
+{
+  DatasetDeltaHeader header{0x1122334455667788, 42, true};
+  Block wire = header.wireEncode();
+  BOOST_TEST(wire.type() == tlv::DatasetDeltaHeader);
+  wire.parse();
+  BOOST_TEST(wire.elements_size() == 3);
+
+  DatasetDeltaHeader decoded;
+  decoded.wireDecode(wire);
+  BOOST_TEST(decoded.epoch == 0x1122334455667788);
+  BOOST_TEST(decoded.version == 42);
+  BOOST_TEST(decoded.isFullSnapshot == true);
+
+  decoded.wireDecode(DatasetDeltaHeader{3, 7, false}.wireEncode());
+  BOOST_TEST(decoded.epoch == 3);
+  BOOST_TEST(decoded.version == 7);
+  BOOST_TEST(decoded.isFullSnapshot == false);
+
+  BOOST_CHECK_THROW(decoded.wireDecode("0800"_block), tlv::Error);
+  // missing DatasetEpoch
+  BOOST_CHECK_THROW(decoded.wireDecode("FD03F200"_block), tlv::Error);
+  // missing DatasetVersion
+  BOOST_CHECK_THROW(decoded.wireDecode("FD03F205 FD03F60105"_block), tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(Removal)
+{
+  DatasetRemoval decoded;
+  decoded.wireDecode(DatasetRemoval{Name("/hello/world")}.wireEncode());
+  BOOST_CHECK(decoded.key == DatasetRemoval::Key(Name("/hello/world")));
+
+  decoded.wireDecode(DatasetRemoval{uint64_t{300}}.wireEncode());
+  BOOST_CHECK(decoded.key == DatasetRemoval::Key(uint64_t{300}));
+
+  BOOST_CHECK_THROW(decoded.wireDecode("0800"_block), tlv::Error);
+  // missing Name or FaceId
+  BOOST_CHECK_THROW(decoded.wireDecode("FD03F500"_block), tlv::Error);
+  // unexpected element
+  BOOST_CHECK_THROW(decoded.wireDecode("FD03F502 0800"_block), tlv::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDatasetDelta
+
+} // namespace nfd::tests
@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/latency-histogram.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(TestLatencyHistogram)
+
+BOOST_AUTO_TEST_CASE(Record)
+{
+  LatencyHistogram h;
+  BOOST_TEST(h.getCount() == 0);
+  BOOST_TEST(h.getQuantile(0.5) == 0_ns);
+
+  h.record(0_ns);
+  h.record(1_ns);
+  h.record(3_ns);
+  h.record(1000_ns);
+  h.record(-5_ns);
+  h.record(time::hours(1000000));
+
+  BOOST_TEST(h.getCount() == 6);
+  BOOST_TEST(h.getMax() == time::hours(1000000));
+  BOOST_TEST(h.getBucket(0) == 3);
+  BOOST_TEST(h.getBucket(1) == 1);
+  BOOST_TEST(h.getBucket(9) == 1); // 512 <= 1000 < 1024
+  BOOST_TEST(h.getBucket(LatencyHistogram::N_BUCKETS - 1) == 1);
+  BOOST_CHECK_THROW(h.getBucket(LatencyHistogram::N_BUCKETS), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(Quantile)
+{
+  LatencyHistogram h;
+  for (int i = 0; i < 99; ++i) {
+    h.record(100_ns);
+  }
+  h.record(5000_ns);
+
+  BOOST_TEST(h.getSum() == 14900_ns);
+  BOOST_TEST(h.getQuantile(0.0) == 127_ns);
+  BOOST_TEST(h.getQuantile(0.5) == 127_ns);
+  BOOST_TEST(h.getQuantile(0.99) == 127_ns);
+  BOOST_TEST(h.getQuantile(1.0) == 5000_ns); // capped at max
+}
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  LatencyStatus status;
+  status.label = "face-rx";
+  status.faceId = 300;
+  status.histogram.record(2_ns);
+  status.histogram.record(40_ns);
+  status.histogram.record(41_ns);
+
+  Block wire = status.wireEncode();
+  BOOST_TEST(wire.type() == tlv::LatencyStatus);
+  wire.parse();
+  // label, FaceId, count, sum, max, and buckets 0 to 5
+  BOOST_TEST(wire.elements_size() == 11);
+
+  LatencyStatus decoded;
+  decoded.wireDecode(wire);
+  BOOST_TEST(decoded.label == "face-rx");
+  BOOST_CHECK(decoded.faceId == 300);
+  BOOST_TEST(decoded.histogram.getCount() == 3);
+  BOOST_TEST(decoded.histogram.getSum() == 83_ns);
+  BOOST_TEST(decoded.histogram.getMax() == 41_ns);
+  BOOST_CHECK(decoded.histogram == status.histogram);
+
+  LatencyStatus empty;
+  empty.label = "pit-insert";
+  decoded.wireDecode(empty.wireEncode());
+  BOOST_TEST(decoded.label == "pit-insert");
+  BOOST_TEST(!decoded.faceId.has_value());
+  BOOST_CHECK(decoded.histogram == LatencyHistogram{});
+}
+
+BOOST_AUTO_TEST_CASE(DecodeError)
+{
+  LatencyStatus decoded;
+  BOOST_CHECK_THROW(decoded.wireDecode("0800"_block), tlv::Error);
+  // missing LatencySum and LatencyMax
+  BOOST_CHECK_THROW(decoded.wireDecode("FD03E80A FD03E90161 FD03EA0101"_block), tlv::Error);
+
+  std::vector<uint8_t> wire{0xFD, 0x03, 0xE8, 0x00, 0xFD, 0x03, 0xE9, 0x00,
+                            0xFD, 0x03, 0xEA, 0x01, 0x00, 0xFD, 0x03, 0xEB, 0x01, 0x00,
+                            0xFD, 0x03, 0xEC, 0x01, 0x00};
+  for (size_t i = 0; i <= LatencyHistogram::N_BUCKETS; ++i) {
+    wire.insert(wire.end(), {0xFD, 0x03, 0xED, 0x01, 0x00});
+  }
+  wire[3] = static_cast<uint8_t>(wire.size() - 4);
+  BOOST_CHECK_THROW(decoded.wireDecode(Block(wire)), tlv::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLatencyHistogram
+
+} // namespace nfd::tests
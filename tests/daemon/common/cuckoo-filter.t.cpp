@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/cuckoo-filter.hpp"
+#include "common/city-hash.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(TestCuckooFilter)
+
+static uint64_t
+makeItem(uint64_t i)
+{
+  return Hash128to64(uint128(i, 0x9ae16a3b2f90404fULL));
+}
+
+BOOST_AUTO_TEST_CASE(InsertContains)
+{
+  CuckooFilter filter(64);
+  BOOST_CHECK_EQUAL(filter.getCapacity(), 64 * CuckooFilter::BUCKET_SIZE);
+  BOOST_CHECK_EQUAL(filter.size(), 0);
+  BOOST_CHECK_EQUAL(filter.contains(makeItem(1)), false);
+
+  BOOST_CHECK_EQUAL(filter.insert(makeItem(1)), true);
+  BOOST_CHECK_EQUAL(filter.size(), 1);
+  BOOST_CHECK_EQUAL(filter.contains(makeItem(1)), true);
+  BOOST_CHECK_EQUAL(filter.contains(makeItem(2)), false);
+  BOOST_CHECK_EQUAL(filter.isFull(), false);
+}
+
+BOOST_AUTO_TEST_CASE(Fill)
+{
+  CuckooFilter filter(1024);
+
+  // insert until the filter becomes full
+  uint64_t nInserted = 0;
+  while (filter.insert(makeItem(nInserted))) {
+    ++nInserted;
+  }
+  BOOST_CHECK_EQUAL(filter.isFull(), true);
+  BOOST_CHECK_EQUAL(filter.size(), nInserted);
+  BOOST_CHECK_LE(filter.size(), filter.getCapacity());
+  // partial-key cuckoo hashing with 4-slot buckets reaches a load factor of about 95%
+  BOOST_CHECK_GT(filter.size(), filter.getCapacity() * 9 / 10);
+
+  // no false negatives, including the item that made the filter full
+  for (uint64_t i = 0; i < nInserted; ++i) {
+    BOOST_CHECK_EQUAL(filter.contains(makeItem(i)), true);
+  }
+
+  // a full filter rejects further insertions
+  BOOST_CHECK_EQUAL(filter.insert(makeItem(nInserted)), false);
+  BOOST_CHECK_EQUAL(filter.size(), nInserted);
+}
+
+BOOST_AUTO_TEST_CASE(FalsePositiveRate)
+{
+  CuckooFilter filter(4096);
+  for (uint64_t i = 0; i < 15000; ++i) {
+    BOOST_REQUIRE(filter.insert(makeItem(i)));
+  }
+
+  size_t nFalsePositives = 0;
+  for (uint64_t i = 1000000; i < 1100000; ++i) {
+    nFalsePositives += filter.contains(makeItem(i));
+  }
+  // expected about 2 * BUCKET_SIZE / 65536 * 100000 = 12
+  BOOST_CHECK_LT(nFalsePositives, 50);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCuckooFilter
+
+} // namespace nfd::tests
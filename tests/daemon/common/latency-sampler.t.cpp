@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/latency-sampler.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+namespace nfd::tests {
+
+class LatencySamplerFixture : public GlobalIoTimeFixture
+{
+protected:
+  ~LatencySamplerFixture()
+  {
+    LatencySampler::setInterval(LatencySampler::DEFAULT_INTERVAL);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestLatencySampler, LatencySamplerFixture)
+
+BOOST_AUTO_TEST_CASE(SetInterval)
+{
+  BOOST_TEST(LatencySampler::getInterval() == LatencySampler::DEFAULT_INTERVAL);
+  LatencySampler::setInterval(1);
+  BOOST_TEST(LatencySampler::getInterval() == 1);
+  LatencySampler::setInterval(0);
+  BOOST_TEST(LatencySampler::getInterval() == 0);
+  BOOST_CHECK_THROW(LatencySampler::setInterval(3), std::invalid_argument);
+  BOOST_TEST(LatencySampler::getInterval() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(Sampling)
+{
+  LatencySampler::setInterval(4);
+  LatencySampler sampler;
+
+  for (int i = 0; i < 10; ++i) {
+    auto stopwatch = sampler.start();
+    advanceClocks(1_ms);
+    stopwatch.stop();
+  }
+  // the 1st, 5th, and 9th occurrences are measured
+  BOOST_TEST(sampler.getHistogram().getCount() == 3);
+  BOOST_TEST(sampler.getHistogram().getSum() == 3_ms);
+
+  LatencySampler::setInterval(0);
+  {
+    LatencySampler::Scope scope(sampler);
+    advanceClocks(1_ms);
+  }
+  BOOST_TEST(sampler.getHistogram().getCount() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(Burst)
+{
+  LatencySampler::setInterval(1);
+  LatencySampler sampler;
+
+  auto stopwatch = sampler.start();
+  advanceClocks(10_ms);
+  stopwatch.stop(5);
+  BOOST_TEST(sampler.getHistogram().getCount() == 1);
+  BOOST_TEST(sampler.getHistogram().getMax() == 2_ms);
+
+  {
+    LatencySampler::Scope scope(sampler);
+    advanceClocks(1_ms);
+  }
+  BOOST_TEST(sampler.getHistogram().getCount() == 2);
+  BOOST_TEST(sampler.getHistogram().getSum() == 3_ms);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLatencySampler
+
+} // namespace nfd::tests
@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/memory-pool.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <list>
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(TestMemoryPool)
+
+BOOST_AUTO_TEST_CASE(FixedSize)
+{
+  FixedSizePool pool(20, 4);
+  BOOST_CHECK_EQUAL(pool.getBlockSize() % alignof(std::max_align_t), 0);
+  BOOST_CHECK_GE(pool.getBlockSize(), 20);
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 0);
+  BOOST_CHECK_EQUAL(pool.getNSlabs(), 0);
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 5; ++i) {
+    blocks.push_back(pool.allocate());
+    BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(blocks.back()) % alignof(std::max_align_t), 0);
+  }
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 5);
+  BOOST_CHECK_EQUAL(pool.getNSlabs(), 2);
+  std::sort(blocks.begin(), blocks.end());
+  BOOST_CHECK(std::adjacent_find(blocks.begin(), blocks.end()) == blocks.end());
+
+  // freed blocks are reused without growing
+  void* block = blocks.back();
+  pool.deallocate(block);
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 4);
+  BOOST_CHECK_EQUAL(pool.allocate(), block);
+  BOOST_CHECK_EQUAL(pool.getNSlabs(), 2);
+
+  for (void* b : blocks) {
+    pool.deallocate(b);
+  }
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SizeClasses)
+{
+  MemoryPool pool;
+  void* p1 = pool.allocate(24);
+  void* p2 = pool.allocate(200);
+  void* p3 = pool.allocate(MemoryPool::MAX_POOLED_SIZE + 1); // system allocator
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 2);
+
+  pool.deallocate(p1, 24);
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 1);
+  // same size class
+  BOOST_CHECK_EQUAL(pool.allocate(17), p1);
+
+  pool.deallocate(p1, 17);
+  pool.deallocate(p2, 200);
+  pool.deallocate(p3, MemoryPool::MAX_POOLED_SIZE + 1);
+  BOOST_CHECK_EQUAL(pool.getNAllocated(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Allocator)
+{
+  auto pool = make_shared<MemoryPool>();
+  {
+    std::list<int, PoolAllocator<int>> list1{PoolAllocator<int>(pool)};
+    list1.push_back(1);
+    list1.push_back(2);
+    BOOST_CHECK_EQUAL(pool->getNAllocated(), 2);
+
+    auto sp = std::allocate_shared<std::string>(PoolAllocator<std::string>(pool), "x");
+    BOOST_CHECK_EQUAL(pool->getNAllocated(), 3);
+
+    // the pool is kept alive by objects allocated from it
+    std::weak_ptr<MemoryPool> weakPool = pool;
+    pool.reset();
+    BOOST_CHECK(!weakPool.expired());
+    pool = weakPool.lock();
+  }
+  BOOST_CHECK_EQUAL(pool->getNAllocated(), 0);
+
+  // default-constructed allocator uses the system allocator
+  std::list<int, PoolAllocator<int>> list2;
+  list2.push_back(1);
+  BOOST_CHECK(list2.get_allocator().getPool() == nullptr);
+  BOOST_CHECK(list2.get_allocator() != PoolAllocator<int>(make_shared<MemoryPool>()));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestMemoryPool
+
+} // namespace nfd::tests
@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/timer-wheel.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+namespace nfd::tests {
+
+BOOST_FIXTURE_TEST_SUITE(TestTimerWheel, GlobalIoTimeFixture)
+
+BOOST_AUTO_TEST_CASE(Fire)
+{
+  TimerWheel wheel;
+  TimerWheel::Timer t1, t2, t3;
+  std::vector<int> fired;
+
+  wheel.schedule(t2, 20_ms, [&] { fired.push_back(2); });
+  wheel.schedule(t1, 10_ms, [&] { fired.push_back(1); });
+  wheel.schedule(t3, 20_ms, [&] { fired.push_back(3); });
+  BOOST_CHECK_EQUAL(wheel.size(), 3);
+  BOOST_CHECK(t1.isPending());
+
+  advanceClocks(1_ms, 9_ms);
+  BOOST_CHECK(fired.empty());
+
+  advanceClocks(1_ms);
+  BOOST_TEST(fired == std::vector<int>({1}), boost::test_tools::per_element());
+  BOOST_CHECK(!t1.isPending());
+  BOOST_CHECK_EQUAL(wheel.size(), 2);
+
+  advanceClocks(1_ms, 10_ms);
+  BOOST_CHECK_EQUAL(fired.size(), 3);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ZeroDelay)
+{
+  TimerWheel wheel;
+  TimerWheel::Timer timer;
+  int nFired = 0;
+
+  wheel.schedule(timer, 0_ms, [&] { ++nFired; });
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nFired, 1);
+
+  // re-arming from the callback with a zero delay fires again at the next tick
+  std::function<void()> rearm = [&] {
+    if (++nFired < 4) {
+      wheel.schedule(timer, 0_ms, rearm);
+    }
+  };
+  wheel.schedule(timer, -5_ms, rearm);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nFired, 2);
+  advanceClocks(1_ms, 5_ms);
+  BOOST_CHECK_EQUAL(nFired, 4);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CancelAndReschedule)
+{
+  TimerWheel wheel;
+  TimerWheel::Timer t1, t2;
+  int nFired1 = 0;
+  int nFired2 = 0;
+
+  wheel.schedule(t1, 10_ms, [&] { ++nFired1; });
+  wheel.schedule(t2, 10_ms, [&] { ++nFired2; });
+  t1.cancel();
+  BOOST_CHECK(!t1.isPending());
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+  t1.cancel(); // no effect
+
+  // rescheduling replaces the previous callback
+  wheel.schedule(t2, 100_ms, [&] { nFired2 += 10; });
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+
+  advanceClocks(1_ms, 50_ms);
+  BOOST_CHECK_EQUAL(nFired1, 0);
+  BOOST_CHECK_EQUAL(nFired2, 0);
+
+  advanceClocks(1_ms, 50_ms);
+  BOOST_CHECK_EQUAL(nFired2, 10);
+
+  {
+    TimerWheel::Timer t3;
+    wheel.schedule(t3, 10_ms, [&] { ++nFired1; });
+    BOOST_CHECK_EQUAL(wheel.size(), 1);
+  } // destroying a pending timer cancels it
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  advanceClocks(1_ms, 20_ms);
+  BOOST_CHECK_EQUAL(nFired1, 0);
+}
+
+BOOST_AUTO_TEST_CASE(CancelFromCallback)
+{
+  TimerWheel wheel;
+  TimerWheel::Timer t1, t2;
+  int nFired = 0;
+
+  // both timers expire at the same tick
+  wheel.schedule(t1, 10_ms, [&] { ++nFired; t2.cancel(); });
+  wheel.schedule(t2, 10_ms, [&] { ++nFired; t1.cancel(); });
+  advanceClocks(1_ms, 20_ms);
+  BOOST_CHECK_EQUAL(nFired, 1);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Cascade)
+{
+  TimerWheel wheel;
+  std::vector<TimerWheel::Timer> timers(5);
+  // spanning every level, plus one beyond the range of the wheel
+  const std::vector<time::nanoseconds> delays{50_ms, 3_s, 200_s, 3_h, 10_h};
+  std::vector<time::steady_clock::time_point> firedAt(delays.size());
+
+  auto start = time::steady_clock::now();
+  for (size_t i = 0; i < delays.size(); ++i) {
+    wheel.schedule(timers[i], delays[i], [&, i] { firedAt[i] = time::steady_clock::now(); });
+  }
+
+  advanceClocks(1_s, 11_h);
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  for (size_t i = 0; i < delays.size(); ++i) {
+    BOOST_TEST_CONTEXT("timer " << i) {
+      // never early, and late by at most one advanceClocks step
+      BOOST_CHECK_GE(firedAt[i] - start, delays[i]);
+      BOOST_CHECK_LE(firedAt[i] - start, delays[i] + 1_s);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(DestroyWheel)
+{
+  TimerWheel::Timer timer;
+  auto owner = make_shared<int>(0);
+  weak_ptr<int> weakOwner = owner;
+  {
+    TimerWheel wheel;
+    wheel.schedule(timer, 10_ms, [owner] { ++*owner; });
+    owner.reset();
+    BOOST_CHECK(!weakOwner.expired());
+  } // destroying the wheel releases the callbacks of pending timers
+  BOOST_CHECK(weakOwner.expired());
+  BOOST_CHECK(!timer.isPending());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTimerWheel
+
+} // namespace nfd::tests
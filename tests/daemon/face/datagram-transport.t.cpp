@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -58,6 +58,68 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Send, T, DatagramTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendBatch, T, DatagramTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  std::vector<Block> packets;
+  for (uint64_t i = 0; i < 5; ++i) {
+    packets.push_back(ndn::encoding::makeNonNegativeIntegerBlock(300, i));
+    this->transport->send(packets.back());
+  }
+  // packets are queued until the current event loop turn completes
+  BOOST_CHECK_EQUAL(this->transport->getSendBatchCounters().nSendBatches, 0);
+
+  for (const auto& packet : packets) {
+    std::vector<uint8_t> readBuf(packet.size());
+    this->remoteRead(readBuf);
+    BOOST_TEST(readBuf == packet, boost::test_tools::per_element());
+  }
+
+  const auto& counters = this->transport->getSendBatchCounters();
+  BOOST_CHECK_EQUAL(counters.nSendBatches, 1);
+  BOOST_CHECK_EQUAL(counters.nSentPackets, 5);
+  BOOST_CHECK_EQUAL(counters.maxBatchSize, 5);
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendQueueFull, T, DatagramTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  ssize_t capacity = this->transport->getSendQueueCapacity();
+  if (capacity < 0) {
+    BOOST_WARN_MESSAGE(false, "skipping test case: send queue capacity is unknown");
+    return;
+  }
+
+  // packets beyond the send queue capacity are dropped before they reach the socket
+  auto packet = ndn::encoding::makeBinaryBlock(300, std::vector<uint8_t>(1000));
+  size_t nFitting = static_cast<size_t>(capacity) / packet.size();
+  for (size_t i = 0; i < nFitting + 10; ++i) {
+    this->transport->send(packet);
+  }
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, nFitting + 10);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutDropped, 10);
+  BOOST_CHECK_GE(this->transport->getSendQueueLength(), static_cast<ssize_t>(nFitting * packet.size()));
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendThenClose, T, DatagramTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // a packet queued in the same turn as close() is still sent
+  auto block1 = ndn::encoding::makeStringBlock(300, "hello");
+  this->transport->send(block1);
+  this->transport->close();
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutDropped, 0);
+
+  std::vector<uint8_t> readBuf(block1.size());
+  this->remoteRead(readBuf);
+  BOOST_TEST(readBuf == block1, boost::test_tools::per_element());
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveNormal, T, DatagramTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
@@ -171,6 +233,11 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendQueueLength, T, DatagramTransportFixtures,
   TRANSPORT_TEST_INIT();
 
   BOOST_CHECK_EQUAL(this->transport->getSendQueueLength(), 0);
+
+  // packets queued in the transport count toward the send queue length
+  auto block1 = ndn::encoding::makeStringBlock(300, "hello");
+  this->transport->send(block1);
+  BOOST_CHECK_GE(this->transport->getSendQueueLength(), static_cast<ssize_t>(block1.size()));
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestDatagramTransport
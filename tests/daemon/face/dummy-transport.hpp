@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -78,6 +78,12 @@ public:
     receive(block);
   }
 
+  void
+  receivePackets(span<const Block> blocks)
+  {
+    receive(blocks);
+  }
+
 protected:
   bool
   canChangePersistencyToImpl(ndn::nfd::FacePersistency) const override
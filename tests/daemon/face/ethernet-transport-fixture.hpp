@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -65,7 +65,8 @@ protected:
   void
   initializeUnicast(shared_ptr<ndn::net::NetworkInterface> netif = nullptr,
                     ndn::nfd::FacePersistency persistency = ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
-                    ethernet::Address remoteAddr = {0x00, 0x00, 0x5e, 0x00, 0x53, 0x5e})
+                    ethernet::Address remoteAddr = {0x00, 0x00, 0x5e, 0x00, 0x53, 0x5e},
+                    face::EthernetBackend backend = face::EthernetBackend::PCAP)
   {
     if (!netif) {
       netif = defaultNetif;
@@ -73,7 +74,7 @@ protected:
 
     localEp = netif->getName();
     remoteEp = remoteAddr;
-    transport = make_unique<face::UnicastEthernetTransport>(*netif, remoteEp, persistency, 2_s);
+    transport = make_unique<face::UnicastEthernetTransport>(*netif, remoteEp, persistency, 2_s, backend);
   }
 
   /**
@@ -82,7 +83,8 @@ protected:
   void
   initializeMulticast(shared_ptr<ndn::net::NetworkInterface> netif = nullptr,
                       ndn::nfd::LinkType linkType = ndn::nfd::LINK_TYPE_MULTI_ACCESS,
-                      ethernet::Address mcastGroup = {0x01, 0x00, 0x5e, 0x90, 0x10, 0x5e})
+                      ethernet::Address mcastGroup = {0x01, 0x00, 0x5e, 0x90, 0x10, 0x5e},
+                      face::EthernetBackend backend = face::EthernetBackend::PCAP)
   {
     if (!netif) {
       netif = defaultNetif;
@@ -90,7 +92,7 @@ protected:
 
     localEp = netif->getName();
     remoteEp = mcastGroup;
-    transport = make_unique<face::MulticastEthernetTransport>(*netif, remoteEp, linkType);
+    transport = make_unique<face::MulticastEthernetTransport>(*netif, remoteEp, linkType, backend);
   }
 
 protected:
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -294,6 +294,69 @@ BOOST_AUTO_TEST_CASE(ReceiveNack)
   BOOST_CHECK_EQUAL(receivedNacks.back().getInterest().wireEncode(), nack1.getInterest().wireEncode());
 }
 
+BOOST_AUTO_TEST_CASE(ReceiveBatch)
+{
+  std::vector<ReceivedPacket> batch;
+  size_t nBatches = 0;
+  face->afterReceiveBatch.connect([&] (span<const ReceivedPacket> packets) {
+    ++nBatches;
+    batch.assign(packets.begin(), packets.end());
+  });
+
+  auto interest1 = makeInterest("/mTpwAnfe6U");
+  auto data1 = makeData("/pBq8vRyaXo");
+  auto nack1 = makeNack(*makeInterest("/localhost/test", false, std::nullopt, 323),
+                        lp::NackReason::NO_ROUTE);
+  lp::Packet lpPacket;
+  lpPacket.set<lp::FragmentField>({nack1.getInterest().wireEncode().begin(),
+                                   nack1.getInterest().wireEncode().end()});
+  lpPacket.set<lp::NackField>(nack1.getHeader());
+  lp::Packet idlePacket;
+  idlePacket.set<lp::SequenceField>(0);
+  const Block burst[] = {interest1->wireEncode(), data1->wireEncode(), lpPacket.wireEncode(),
+                         idlePacket.wireEncode()};
+
+  transport->receivePackets(burst);
+
+  BOOST_CHECK_EQUAL(nBatches, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nInInterests, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nInData, 1);
+  BOOST_CHECK_EQUAL(service->getCounters().nInNacks, 1);
+  BOOST_CHECK_EQUAL(receivedInterests.size(), 0);
+  BOOST_CHECK_EQUAL(receivedData.size(), 0);
+  BOOST_CHECK_EQUAL(receivedNacks.size(), 0);
+
+  BOOST_REQUIRE_EQUAL(batch.size(), 3);
+  auto interest = std::get_if<shared_ptr<const Interest>>(&batch[0].packet);
+  BOOST_REQUIRE(interest != nullptr);
+  BOOST_CHECK_EQUAL((*interest)->wireEncode(), interest1->wireEncode());
+  auto data = std::get_if<shared_ptr<const Data>>(&batch[1].packet);
+  BOOST_REQUIRE(data != nullptr);
+  BOOST_CHECK_EQUAL((*data)->wireEncode(), data1->wireEncode());
+  auto nack = std::get_if<shared_ptr<const lp::Nack>>(&batch[2].packet);
+  BOOST_REQUIRE(nack != nullptr);
+  BOOST_CHECK_EQUAL((*nack)->getReason(), nack1.getReason());
+
+  // a single packet is still delivered through the per-packet signals
+  transport->receivePacket(interest1->wireEncode());
+  BOOST_CHECK_EQUAL(nBatches, 1);
+  BOOST_CHECK_EQUAL(receivedInterests.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ReceiveBatchWithoutSubscriber)
+{
+  auto interest1 = makeInterest("/mTpwAnfe6U");
+  auto interest2 = makeInterest("/QVHzyYjZbt");
+  const Block burst[] = {interest1->wireEncode(), interest2->wireEncode()};
+
+  transport->receivePackets(burst);
+
+  BOOST_CHECK_EQUAL(service->getCounters().nInInterests, 2);
+  BOOST_REQUIRE_EQUAL(receivedInterests.size(), 2);
+  BOOST_CHECK_EQUAL(receivedInterests[0].wireEncode(), interest1->wireEncode());
+  BOOST_CHECK_EQUAL(receivedInterests[1].wireEncode(), interest2->wireEncode());
+}
+
 BOOST_AUTO_TEST_CASE(ReceiveIdlePacket)
 {
   // Initialize with Options that disables all services
@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/receive-buffer.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace nfd::tests {
+
+using namespace nfd::face;
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_AUTO_TEST_SUITE(TestReceiveBuffer)
+
+// writes a TLV element of type 300 with a value of 'valueSize' bytes at 'offset'
+static Block
+writeElement(ReceiveBuffer& buffer, size_t offset, size_t valueSize)
+{
+  auto element = ndn::encoding::makeStringBlock(300, std::string(valueSize, 'x'));
+  BOOST_REQUIRE_LE(offset + element.size(), buffer.size());
+  std::memcpy(buffer.data() + offset, element.data(), element.size());
+  return element;
+}
+
+BOOST_AUTO_TEST_CASE(LargePacketInPlace)
+{
+  ReceiveBuffer buffer(1000);
+  auto expected = writeElement(buffer, 0, 600);
+
+  {
+    auto [isOk, element] = buffer.decode(0, expected.size());
+    BOOST_REQUIRE(isOk);
+    BOOST_TEST(element == expected);
+    BOOST_CHECK(element.data() == buffer.data());
+    BOOST_CHECK(buffer.isShared());
+  }
+  BOOST_CHECK(!buffer.isShared());
+}
+
+BOOST_AUTO_TEST_CASE(SharedRatio)
+{
+  // a 100-byte element occupies exactly 1/MAX_SHARED_RATIO of the storage
+  ReceiveBuffer buffer(100 * ReceiveBuffer::MAX_SHARED_RATIO);
+  auto expected = writeElement(buffer, 0, 96);
+  BOOST_REQUIRE_EQUAL(expected.size(), 100);
+
+  auto [isOk, element] = buffer.decode(0, expected.size());
+  BOOST_REQUIRE(isOk);
+  BOOST_CHECK(element.data() == buffer.data());
+  BOOST_CHECK(buffer.isShared());
+}
+
+BOOST_AUTO_TEST_CASE(SmallPacketCopied)
+{
+  ReceiveBuffer buffer(1000);
+  auto expected1 = writeElement(buffer, 0, 50);
+  auto expected2 = writeElement(buffer, expected1.size(), 100);
+  size_t length = expected1.size() + expected2.size();
+
+  auto [isOk1, element1] = buffer.decode(0, length);
+  BOOST_REQUIRE(isOk1);
+  BOOST_TEST(element1 == expected1);
+  auto [isOk2, element2] = buffer.decode(element1.size(), length - element1.size());
+  BOOST_REQUIRE(isOk2);
+  BOOST_TEST(element2 == expected2);
+  BOOST_CHECK(!buffer.isShared());
+}
+
+BOOST_AUTO_TEST_CASE(Incomplete)
+{
+  ReceiveBuffer buffer(1000);
+  auto expected = writeElement(buffer, 0, 600);
+
+  // the bytes after 'length' must not be used
+  BOOST_CHECK_EQUAL(std::get<0>(buffer.decode(0, expected.size() - 1)), false);
+  BOOST_CHECK_EQUAL(std::get<0>(buffer.decode(0, 0)), false);
+  BOOST_CHECK(!buffer.isShared());
+}
+
+BOOST_AUTO_TEST_CASE(PrepareUnshared)
+{
+  ReceiveBuffer buffer(1000);
+  const uint8_t* storage = buffer.data();
+  auto expected = writeElement(buffer, 100, 50);
+
+  buffer.prepare(100, expected.size());
+  BOOST_CHECK(buffer.data() == storage);
+  auto [isOk, element] = buffer.decode(0, expected.size());
+  BOOST_REQUIRE(isOk);
+  BOOST_TEST(element == expected);
+}
+
+BOOST_AUTO_TEST_CASE(PrepareShared)
+{
+  ReceiveBuffer buffer(1000);
+  const uint8_t* storage1 = buffer.data();
+  auto expected1 = writeElement(buffer, 0, 600);
+  auto expected2 = writeElement(buffer, expected1.size(), 20);
+
+  auto [isOk1, element1] = buffer.decode(0, expected1.size() + 10);
+  BOOST_REQUIRE(isOk1);
+  BOOST_CHECK(element1.data() == storage1);
+
+  // the partially received element is moved to a new storage,
+  // while the decoded element keeps referencing the old one
+  buffer.prepare(expected1.size(), 10);
+  const uint8_t* storage2 = buffer.data();
+  BOOST_CHECK(storage2 != storage1);
+  BOOST_CHECK(!buffer.isShared());
+  BOOST_TEST(element1 == expected1);
+  BOOST_CHECK(std::equal(expected2.begin(), expected2.begin() + 10, buffer.data()));
+
+  // the new storage is referenced in turn, the old one is reused once released
+  std::memcpy(buffer.data(), expected1.data(), expected1.size());
+  auto [isOk2, element2] = buffer.decode(0, expected1.size());
+  BOOST_REQUIRE(isOk2);
+  BOOST_CHECK(element2.data() == storage2);
+  element1 = Block{};
+  buffer.prepare();
+  BOOST_CHECK(buffer.data() == storage1);
+  BOOST_TEST(element2 == expected1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestReceiveBuffer
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace nfd::tests
@@ -0,0 +1,192 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/shm-ring.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace nfd::tests {
+
+using namespace nfd::face;
+
+BOOST_AUTO_TEST_SUITE(Face)
+
+class ShmRingFixture
+{
+protected:
+  static constexpr size_t CAPACITY = 256;
+
+  static std::vector<uint8_t>
+  makePacket(size_t size, uint8_t value)
+  {
+    return std::vector<uint8_t>(size, value);
+  }
+
+  static void
+  checkFront(ShmRing& ring, const std::vector<uint8_t>& expected)
+  {
+    auto packet = ring.front();
+    BOOST_TEST(packet == expected, boost::test_tools::per_element());
+  }
+
+  /**
+   * \brief Overwrites the head index in the control data, like a faulty producer would.
+   */
+  void
+  setHead(uint64_t head)
+  {
+    std::memcpy(region.data(), &head, sizeof(head));
+  }
+
+  /**
+   * \brief Overwrites the record length at \p offset in the data area.
+   */
+  void
+  setLength(size_t offset, uint32_t length)
+  {
+    std::memcpy(region.data() + ShmRing::HEADER_SIZE + offset, &length, sizeof(length));
+  }
+
+protected:
+  alignas(64) std::array<uint8_t, ShmRing::getRegionSize(CAPACITY)> region{};
+  ShmRing producer{region.data(), CAPACITY, true};
+  ShmRing consumer{region.data(), CAPACITY, false};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestShmRing, ShmRingFixture)
+
+BOOST_AUTO_TEST_CASE(PushPop)
+{
+  BOOST_CHECK_EQUAL(producer.getMaxPacketSize(), CAPACITY / 2 - 4);
+  BOOST_CHECK(consumer.front().empty());
+
+  auto p1 = makePacket(10, 0x01);
+  auto p2 = makePacket(20, 0x02);
+  BOOST_CHECK(producer.push(p1));
+  BOOST_CHECK(producer.push(p2));
+
+  checkFront(consumer, p1);
+  checkFront(consumer, p1); // front() does not consume
+  consumer.pop();
+  checkFront(consumer, p2);
+  consumer.pop();
+  BOOST_CHECK(consumer.front().empty());
+}
+
+BOOST_AUTO_TEST_CASE(Wrap)
+{
+  // each record takes 104 octets, so every few records do not fit before the end of the data area
+  for (int i = 0; i < 20; ++i) {
+    auto p = makePacket(100, static_cast<uint8_t>(i));
+    BOOST_REQUIRE(producer.push(p));
+    checkFront(consumer, p);
+    consumer.pop();
+    BOOST_CHECK(consumer.front().empty());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Full)
+{
+  auto p1 = makePacket(100, 0x01);
+  auto p2 = makePacket(100, 0x02);
+  auto p3 = makePacket(100, 0x03);
+  BOOST_CHECK(producer.push(p1));
+  BOOST_CHECK(producer.push(p2));
+  // the third record would need to wrap, which requires the space of the first record
+  BOOST_CHECK(!producer.push(p3));
+
+  BOOST_CHECK(!consumer.clearProducerWaiting());
+  producer.setProducerWaiting();
+  checkFront(consumer, p1);
+  consumer.pop();
+  BOOST_CHECK(consumer.clearProducerWaiting());
+  BOOST_CHECK(!consumer.clearProducerWaiting());
+
+  BOOST_CHECK(producer.push(p3));
+  checkFront(consumer, p2);
+  consumer.pop();
+  checkFront(consumer, p3);
+  consumer.pop();
+  BOOST_CHECK(consumer.front().empty());
+}
+
+BOOST_AUTO_TEST_CASE(CorruptedHead)
+{
+  BOOST_CHECK(producer.push(makePacket(10, 0x01)));
+  setHead(CAPACITY + 8);
+  BOOST_CHECK(consumer.front().empty());
+  BOOST_CHECK(consumer.isCorrupted());
+
+  // the ring stays unusable even if the head is restored
+  setHead(16);
+  BOOST_CHECK(consumer.front().empty());
+  BOOST_CHECK(consumer.isCorrupted());
+}
+
+BOOST_AUTO_TEST_CASE(CorruptedLength)
+{
+  BOOST_CHECK(producer.push(makePacket(10, 0x01)));
+  setLength(0, CAPACITY);
+  BOOST_CHECK(consumer.front().empty());
+  BOOST_CHECK(consumer.isCorrupted());
+}
+
+BOOST_AUTO_TEST_CASE(RecordBeyondHead)
+{
+  // the record fits in the data area, but extends past the published part of it
+  BOOST_CHECK(producer.push(makePacket(10, 0x01)));
+  setLength(0, 40);
+  BOOST_CHECK(consumer.front().empty());
+  BOOST_CHECK(consumer.isCorrupted());
+}
+
+BOOST_AUTO_TEST_CASE(WrapMarkerBeyondHead)
+{
+  BOOST_CHECK(producer.push(makePacket(10, 0x01)));
+  setLength(0, ShmRing::WRAP_MARKER);
+  BOOST_CHECK(consumer.front().empty());
+  BOOST_CHECK(consumer.isCorrupted());
+}
+
+BOOST_AUTO_TEST_CASE(NotCorruptedWhenEmpty)
+{
+  BOOST_CHECK(consumer.front().empty());
+  BOOST_CHECK(!consumer.isCorrupted());
+
+  auto p = makePacket(10, 0x01);
+  BOOST_CHECK(producer.push(p));
+  checkFront(consumer, p);
+  consumer.pop();
+  BOOST_CHECK(consumer.front().empty());
+  BOOST_CHECK(!consumer.isCorrupted());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestShmRing
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace nfd::tests
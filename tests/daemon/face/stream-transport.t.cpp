@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -69,6 +69,34 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Send, T, StreamTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendBatch, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // enough data to need several gather writes, some of which are only partially accepted
+  std::vector<uint8_t> expected;
+  for (int i = 0; i < 400; ++i) {
+    auto block = ndn::encoding::makeStringBlock(300, std::string(i % 2 == 0 ? 20 : 8000, 'a' + i % 26));
+    this->transport->send(block);
+    expected.insert(expected.end(), block.begin(), block.end());
+  }
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, 400);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutBytes, expected.size());
+  BOOST_CHECK_EQUAL(this->transport->getSendQueueLength(), expected.size());
+
+  std::vector<uint8_t> readBuf(expected.size());
+  boost::asio::async_read(this->remoteSocket, boost::asio::buffer(readBuf),
+    [this] (const boost::system::error_code& error, size_t) {
+      BOOST_REQUIRE_EQUAL(error, boost::system::errc::success);
+      this->limitedIo.afterOp();
+    });
+
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, 5_s), LimitedIo::EXCEED_OPS);
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveNormal, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
@@ -136,6 +164,48 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveMultipleBlocks, T, StreamTransportFixtur
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveBurst, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // more bytes than the receive buffer can hold, so that unparsed bytes must be moved
+  std::vector<Block> packets;
+  ndn::Buffer buf;
+  for (int i = 0; i < 60; ++i) {
+    packets.push_back(ndn::encoding::makeStringBlock(300, std::string(i % 3 == 0 ? 7000 : 30, 'a' + i % 26)));
+    buf.insert(buf.end(), packets.back().begin(), packets.back().end());
+  }
+
+  this->remoteWrite(buf);
+
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInPackets, packets.size());
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInBytes, buf.size());
+  BOOST_REQUIRE_EQUAL(this->receivedPackets->size(), packets.size());
+  for (size_t i = 0; i < packets.size(); ++i) {
+    BOOST_CHECK(this->receivedPackets->at(i).packet == packets[i]);
+  }
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveFullSizeInPlace, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  const std::vector<uint8_t> bytes(ndn::MAX_NDN_PACKET_SIZE - 6, 0);
+  auto pkt = ndn::encoding::makeBinaryBlock(300, bytes);
+  BOOST_REQUIRE_EQUAL(pkt.size(), ndn::MAX_NDN_PACKET_SIZE);
+  ndn::Buffer buf(pkt.begin(), pkt.end());
+
+  this->remoteWrite(buf);
+
+  BOOST_REQUIRE_EQUAL(this->receivedPackets->size(), 1);
+  const Block& received = this->receivedPackets->at(0).packet;
+  BOOST_CHECK(received == pkt);
+  // the packet references the receive buffer, which holds two packets, instead of a copy
+  BOOST_CHECK_GT(received.getBuffer()->size(), received.size());
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveTooLarge, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
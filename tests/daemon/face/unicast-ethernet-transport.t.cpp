@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -29,6 +29,17 @@
 
 #include "tests/daemon/face/transport-test-common.hpp"
 
+#if defined(__linux__)
+#include <algorithm>
+#include <array>
+
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
 namespace nfd::tests {
 
 using namespace nfd::face;
@@ -169,6 +180,72 @@ BOOST_AUTO_TEST_CASE(IdleClose)
   BOOST_CHECK_EQUAL(nStateChanges, 2);
 }
 
+#if defined(__linux__)
+BOOST_AUTO_TEST_CASE(PacketRingSend)
+{
+  SKIP_IF_NO_RUNNING_ETHERNET_NETIF();
+  auto netif = getRunningNetif();
+  const ethernet::Address remoteAddr{0x00, 0x00, 0x5e, 0x00, 0x53, 0x5e};
+
+  // capture the outgoing frames on the same netif; only ETH_P_ALL sockets see them
+  int captureFd = ::socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+  BOOST_REQUIRE_GE(captureFd, 0);
+  sockaddr_ll sll{};
+  sll.sll_family = AF_PACKET;
+  sll.sll_protocol = htons(ETH_P_ALL);
+  sll.sll_ifindex = netif->getIndex();
+  BOOST_REQUIRE_EQUAL(::bind(captureFd, reinterpret_cast<sockaddr*>(&sll), sizeof(sll)), 0);
+  int rcvbuf = 8 * 1024 * 1024;
+  if (::setsockopt(captureFd, SOL_SOCKET, SO_RCVBUFFORCE, &rcvbuf, sizeof(rcvbuf)) < 0) {
+    ::setsockopt(captureFd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  }
+
+  initializeUnicast(netif, ndn::nfd::FACE_PERSISTENCY_PERSISTENT,
+                    remoteAddr, EthernetBackend::TPACKET_V3);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+
+  // more frames than the TX ring can hold in one turn, including a short one that needs padding
+  for (int i = 0; i < 300; ++i) {
+    transport->send(ndn::encoding::makeStringBlock(300, i == 0 ? "" : std::string(1000, 'x')));
+  }
+  // frames that did not fit in the TX ring are counted as dropped, in addition to being counted as sent
+  const auto& counters = transport->getCounters();
+  BOOST_CHECK_EQUAL(counters.nOutPackets, 300);
+  BOOST_CHECK_LT(counters.nOutDropped, 300);
+
+  // closing hands the frames still queued in the TX ring to the kernel
+  transport->close();
+  transport->afterStateChange.connectSingleShot([this] (auto oldState, auto newState) {
+    BOOST_CHECK_EQUAL(oldState, TransportState::CLOSING);
+    BOOST_CHECK_EQUAL(newState, TransportState::CLOSED);
+    this->limitedIo.afterOp();
+  });
+  BOOST_REQUIRE_EQUAL(limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+
+  size_t nCaptured = 0;
+  std::array<uint8_t, 2048> frame;
+  while (true) {
+    ssize_t len = ::recv(captureFd, frame.data(), frame.size(), MSG_DONTWAIT);
+    if (len < 0) {
+      break;
+    }
+    if (len >= static_cast<ssize_t>(ethernet::HDR_LEN + 3) &&
+        std::equal(remoteAddr.begin(), remoteAddr.end(), frame.begin()) &&
+        frame[12] == 0x86 && frame[13] == 0x24 &&
+        frame[14] == 0xfd && frame[15] == 0x01 && frame[16] == 0x2c) {
+      ++nCaptured;
+    }
+  }
+  tpacket_stats stats{};
+  socklen_t statsLen = sizeof(stats);
+  BOOST_CHECK_EQUAL(::getsockopt(captureFd, SOL_PACKET, PACKET_STATISTICS, &stats, &statsLen), 0);
+  ::close(captureFd);
+
+  // every frame that was not dropped reached the wire, unless the capture socket itself overflowed
+  BOOST_CHECK_EQUAL(nCaptured + stats.tp_drops, counters.nOutPackets - counters.nOutDropped);
+}
+#endif // defined(__linux__)
+
 BOOST_AUTO_TEST_CASE(SendQueueLength)
 {
   SKIP_IF_ETHERNET_NETIF_COUNT_LT(1);
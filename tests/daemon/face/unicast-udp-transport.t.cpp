@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -75,6 +75,47 @@ BOOST_AUTO_TEST_CASE(ExpirationTime)
   BOOST_CHECK_NE(transport->getExpirationTime(), time::steady_clock::time_point::max());
 }
 
+BOOST_AUTO_TEST_CASE(ReceiveBurst)
+{
+  TRANSPORT_TEST_INIT();
+
+  // datagrams queued on the socket before the transport gets to run are delivered in order
+  const size_t nPackets = face::DatagramBatch::MAX_SIZE + 5;
+  std::vector<Block> packets;
+  for (size_t i = 0; i < nPackets; ++i) {
+    packets.push_back(ndn::encoding::makeNonNegativeIntegerBlock(300, i));
+    remoteSocket.send(boost::asio::buffer(packets.back()));
+  }
+  limitedIo.defer(1_s);
+
+  BOOST_CHECK_EQUAL(transport->getCounters().nInPackets, nPackets);
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), nPackets);
+  for (size_t i = 0; i < nPackets; ++i) {
+    BOOST_CHECK(receivedPackets->at(i).packet == packets[i]);
+  }
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+
+BOOST_AUTO_TEST_CASE(ReceiveLargeBurst)
+{
+  TRANSPORT_TEST_INIT();
+
+  // large packets reference the receive buffers, which must not be overwritten
+  // by subsequent datagrams while the packets are retained
+  const size_t nPackets = 20;
+  std::vector<Block> packets;
+  for (size_t i = 0; i < nPackets; ++i) {
+    packets.push_back(ndn::encoding::makeStringBlock(300, std::string(5000, 'a' + i)));
+    remoteSocket.send(boost::asio::buffer(packets.back()));
+  }
+  limitedIo.defer(1_s);
+
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), nPackets);
+  for (size_t i = 0; i < nPackets; ++i) {
+    BOOST_CHECK(receivedPackets->at(i).packet == packets[i]);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(IdleClose)
 {
   TRANSPORT_TEST_INIT(ndn::nfd::FACE_PERSISTENCY_ON_DEMAND);
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -25,6 +25,18 @@
 
 #include "unix-stream-transport-fixture.hpp"
 
+#if defined(__linux__)
+#include "face/shm-ring.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
 namespace nfd::tests {
 
 using namespace nfd::face;
@@ -58,6 +70,218 @@ BOOST_AUTO_TEST_CASE(PersistencyChange)
   BOOST_CHECK_EQUAL(transport->canChangePersistencyTo(ndn::nfd::FACE_PERSISTENCY_PERMANENT), false);
 }
 
+#if defined(__linux__)
+/**
+ * \brief Plays the client side of the shared memory handshake.
+ */
+class ShmClientFixture : public UnixStreamTransportFixture
+{
+protected:
+  ~ShmClientFixture()
+  {
+    if (region != nullptr) {
+      ::munmap(region, regionSize);
+    }
+    for (int fd : {memfd, toNfdEvent, fromNfdEvent}) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+  }
+
+  /**
+   * \brief Receives the handshake reply and the file descriptors, and maps the rings.
+   */
+  void
+  receiveHandshakeReply()
+  {
+    std::array<uint8_t, 16> replyBuf{};
+    iovec iov{replyBuf.data(), replyBuf.size()};
+    alignas(cmsghdr) char control[CMSG_SPACE(3 * sizeof(int))] = {};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    ssize_t nRead = ::recvmsg(remoteSocket.native_handle(), &msg, MSG_DONTWAIT);
+    BOOST_REQUIRE_GT(nRead, 0);
+    auto [isOk, reply] = Block::fromBuffer(span<const uint8_t>(replyBuf.data(), nRead));
+    BOOST_REQUIRE(isOk);
+    BOOST_CHECK_EQUAL(reply.type(), UnixStreamTransport::SHM_HANDSHAKE_TYPE);
+    const size_t capacity = ndn::encoding::readNonNegativeInteger(reply);
+    BOOST_REQUIRE_EQUAL(capacity, UnixStreamTransport::SHM_RING_CAPACITY);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    BOOST_REQUIRE(cmsg != nullptr);
+    BOOST_REQUIRE_EQUAL(cmsg->cmsg_type, SCM_RIGHTS);
+    BOOST_REQUIRE_EQUAL(cmsg->cmsg_len, CMSG_LEN(3 * sizeof(int)));
+    int fds[3];
+    std::memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+    memfd = fds[0];
+    toNfdEvent = fds[1];
+    fromNfdEvent = fds[2];
+
+    regionSize = 2 * ShmRing::getRegionSize(capacity);
+    void* addr = ::mmap(nullptr, regionSize, PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    BOOST_REQUIRE(addr != MAP_FAILED);
+    region = static_cast<uint8_t*>(addr);
+    toNfd.emplace(region, capacity, false);
+    fromNfd.emplace(region + ShmRing::getRegionSize(capacity), capacity, false);
+  }
+
+  void
+  sendHandshake()
+  {
+    auto handshake = ndn::encoding::makeEmptyBlock(UnixStreamTransport::SHM_HANDSHAKE_TYPE);
+    remoteWrite(ndn::Buffer(handshake.begin(), handshake.end()));
+    BOOST_REQUIRE(transport->isUsingSharedMemory());
+    receiveHandshakeReply();
+  }
+
+  void
+  signalNfd()
+  {
+    uint64_t one = 1;
+    BOOST_REQUIRE_EQUAL(::write(toNfdEvent, &one, sizeof(one)), static_cast<ssize_t>(sizeof(one)));
+  }
+
+protected:
+  int memfd = -1;
+  int toNfdEvent = -1;
+  int fromNfdEvent = -1;
+  uint8_t* region = nullptr;
+  size_t regionSize = 0;
+  std::optional<ShmRing> toNfd;
+  std::optional<ShmRing> fromNfd;
+};
+
+BOOST_FIXTURE_TEST_CASE(SharedMemory, ShmClientFixture)
+{
+  initialize();
+  BOOST_CHECK(!transport->isUsingSharedMemory());
+
+  // the handshake is followed by a packet in the same write, which is still delivered
+  auto handshake = ndn::encoding::makeEmptyBlock(UnixStreamTransport::SHM_HANDSHAKE_TYPE);
+  auto pkt1 = ndn::encoding::makeStringBlock(300, "hello");
+  ndn::Buffer buf(handshake.begin(), handshake.end());
+  buf.insert(buf.end(), pkt1.begin(), pkt1.end());
+  remoteWrite(buf);
+  BOOST_REQUIRE(transport->isUsingSharedMemory());
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), 1);
+  BOOST_CHECK(receivedPackets->back().packet == pkt1);
+
+  // receive the reply and the file descriptors like a client would
+  receiveHandshakeReply();
+
+  // client to NFD
+  auto pkt2 = ndn::encoding::makeStringBlock(301, "world");
+  auto pkt3 = ndn::encoding::makeStringBlock(302, "!");
+  BOOST_CHECK(toNfd->push(pkt2));
+  BOOST_CHECK(toNfd->push(pkt3));
+  signalNfd();
+  limitedIo.defer(100_ms);
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), 3);
+  BOOST_CHECK(receivedPackets->at(1).packet == pkt2);
+  BOOST_CHECK(receivedPackets->at(2).packet == pkt3);
+  BOOST_CHECK_EQUAL(transport->getCounters().nInPackets, 3);
+  BOOST_CHECK_EQUAL(transport->getCounters().nInBytes, pkt1.size() + pkt2.size() + pkt3.size());
+
+  // NFD to client, both packets are announced with a single event
+  auto pkt4 = ndn::encoding::makeStringBlock(303, "foo");
+  auto pkt5 = ndn::encoding::makeStringBlock(304, "bar");
+  transport->send(pkt4);
+  transport->send(pkt5);
+  limitedIo.defer(100_ms);
+  uint64_t counter = 0;
+  BOOST_CHECK_EQUAL(::read(fromNfdEvent, &counter, sizeof(counter)), static_cast<ssize_t>(sizeof(counter)));
+  BOOST_CHECK_EQUAL(counter, 1);
+  auto wire = fromNfd->front();
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(), pkt4.begin(), pkt4.end());
+  fromNfd->pop();
+  wire = fromNfd->front();
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(), pkt5.begin(), pkt5.end());
+  fromNfd->pop();
+  BOOST_CHECK(fromNfd->front().empty());
+  BOOST_CHECK_EQUAL(transport->getSendQueueLength(), 0);
+
+  // closing the socket still closes the transport
+  remoteSocket.close();
+  limitedIo.defer(100_ms);
+  BOOST_CHECK_EQUAL(transport->getState(), face::TransportState::CLOSED);
+}
+
+BOOST_FIXTURE_TEST_CASE(SharedMemorySealed, ShmClientFixture)
+{
+  initialize();
+  sendHandshake();
+
+  // shrinking the region would make NFD's accesses to its mapping raise SIGBUS
+  BOOST_CHECK_LT(::ftruncate(memfd, 0), 0);
+  BOOST_CHECK_LT(::ftruncate(memfd, static_cast<off_t>(2 * regionSize)), 0);
+
+  auto pkt = ndn::encoding::makeStringBlock(300, "hello");
+  BOOST_CHECK(toNfd->push(pkt));
+  signalNfd();
+  transport->send(pkt);
+  limitedIo.defer(100_ms);
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), 1);
+  BOOST_CHECK(receivedPackets->back().packet == pkt);
+  auto wire = fromNfd->front();
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(), pkt.begin(), pkt.end());
+  BOOST_CHECK_EQUAL(transport->getState(), face::TransportState::UP);
+}
+
+BOOST_FIXTURE_TEST_CASE(SharedMemoryCorrupted, ShmClientFixture)
+{
+  initialize();
+  sendHandshake();
+
+  // a record whose length exceeds the ring is not read, and fails the face
+  auto pkt = ndn::encoding::makeStringBlock(300, "hello");
+  BOOST_CHECK(toNfd->push(pkt));
+  uint32_t length = UnixStreamTransport::SHM_RING_CAPACITY;
+  std::memcpy(region + ShmRing::HEADER_SIZE, &length, sizeof(length));
+  signalNfd();
+  limitedIo.defer(100_ms);
+  BOOST_CHECK_EQUAL(receivedPackets->size(), 0);
+  BOOST_CHECK_EQUAL(transport->getState(), face::TransportState::CLOSED);
+}
+
+BOOST_FIXTURE_TEST_CASE(SharedMemoryOverflowLimit, ShmClientFixture)
+{
+  initialize();
+  sendHandshake();
+
+  // the client never pops, so packets beyond the ring and the overflow limit are dropped
+  auto pkt = ndn::encoding::makeBinaryBlock(300, std::vector<uint8_t>(8000));
+  const size_t nPackets = (UnixStreamTransport::SHM_RING_CAPACITY +
+                           UnixStreamTransport::SHM_OVERFLOW_LIMIT) / pkt.size() + 10;
+  for (size_t i = 0; i < nPackets; ++i) {
+    transport->send(pkt);
+  }
+  limitedIo.defer(100_ms);
+  BOOST_CHECK_GT(transport->getSendQueueLength(), 0);
+  BOOST_CHECK_LE(transport->getSendQueueLength(),
+                 static_cast<ssize_t>(UnixStreamTransport::SHM_OVERFLOW_LIMIT));
+  BOOST_CHECK_EQUAL(transport->getState(), face::TransportState::UP);
+
+  // the queued packets are sent once the client makes room
+  size_t nReceived = 0;
+  while (!fromNfd->front().empty()) {
+    fromNfd->pop();
+    ++nReceived;
+  }
+  signalNfd();
+  limitedIo.defer(100_ms);
+  while (!fromNfd->front().empty()) {
+    fromNfd->pop();
+    ++nReceived;
+  }
+  BOOST_CHECK_LT(nReceived, nPackets);
+  BOOST_CHECK_EQUAL(transport->getSendQueueLength(), 0);
+}
+#endif // defined(__linux__)
+
 BOOST_AUTO_TEST_SUITE_END() // TestUnixStreamTransport
 BOOST_AUTO_TEST_SUITE_END() // Face
 
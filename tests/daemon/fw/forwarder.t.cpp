@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -25,10 +25,12 @@
 
 #include "fw/forwarder.hpp"
 #include "common/global.hpp"
+#include "face/generic-link-service.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/daemon/global-io-fixture.hpp"
 #include "tests/daemon/face/dummy-face.hpp"
+#include "tests/daemon/face/dummy-transport.hpp"
 #include "choose-strategy.hpp"
 #include "dummy-strategy.hpp"
 
@@ -39,6 +41,17 @@ namespace nfd::tests {
 class ForwarderFixture : public GlobalIoTimeFixture
 {
 protected:
+  ForwarderFixture()
+  {
+    // the sampling interval is process-wide, do not depend on the tests that ran before
+    LatencySampler::setInterval(LatencySampler::DEFAULT_INTERVAL);
+  }
+
+  ~ForwarderFixture()
+  {
+    LatencySampler::setInterval(LatencySampler::DEFAULT_INTERVAL);
+  }
+
   template<typename ...Args>
   shared_ptr<DummyFace>
   addFace(Args&&... args)
@@ -112,6 +125,36 @@ BOOST_AUTO_TEST_CASE(SimpleExchange)
   BOOST_CHECK_EQUAL(counters.nCsMisses, 1);
 }
 
+BOOST_AUTO_TEST_CASE(IncomingBatch)
+{
+  auto face1 = make_shared<Face>(make_unique<face::GenericLinkService>(),
+                                 make_unique<DummyTransport>());
+  faceTable.add(face1);
+  auto transport1 = static_cast<DummyTransport*>(face1->getTransport());
+  auto face2 = addFace();
+
+  Fib& fib = forwarder.getFib();
+  fib::Entry* entry = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entry, *face2, 0);
+
+  auto interest1 = makeInterest("/A/1");
+  auto interest2 = makeInterest("/A/2");
+  auto interest3 = makeInterest("/B/3");
+  const Block burst[] = {interest1->wireEncode(), interest2->wireEncode(), interest3->wireEncode()};
+  transport1->receivePackets(burst);
+
+  BOOST_CHECK_EQUAL(counters.nInInterests, 3);
+  BOOST_CHECK_EQUAL(counters.nOutInterests, 2);
+  BOOST_REQUIRE_EQUAL(face2->sentInterests.size(), 2);
+  BOOST_CHECK_EQUAL(face2->sentInterests[0].getName(), "/A/1");
+  BOOST_CHECK_EQUAL(face2->sentInterests[1].getName(), "/A/2");
+  auto incomingFaceId = face2->sentInterests[0].getTag<lp::IncomingFaceIdTag>();
+  BOOST_REQUIRE(incomingFaceId != nullptr);
+  BOOST_CHECK_EQUAL(*incomingFaceId, face1->getId());
+  // no route for /B
+  BOOST_CHECK_EQUAL(face1->getCounters().nOutNacks, 1);
+}
+
 BOOST_AUTO_TEST_CASE(CsHit)
 {
   auto face1 = addFace();
@@ -160,6 +203,56 @@ BOOST_AUTO_TEST_CASE(CsHit)
   BOOST_CHECK_EQUAL(counters.nUnsolicitedData, 0);
 }
 
+BOOST_AUTO_TEST_CASE(CsHitInDiskTier)
+{
+  auto face1 = addFace();
+  auto face2 = addFace();
+  auto face3 = addFace();
+  auto face4 = addFace();
+
+  Fib& fib = forwarder.getFib();
+  fib::Entry* entry = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entry, *face2, 0);
+
+  // /A/1 is evicted from memory into the disk tier
+  Cs& cs = forwarder.getCs();
+  cs.setLimit(1);
+  cs.setDiskStore(make_unique<cs::DiskStore>(UNIT_TESTS_TMPDIR "/forwarder-disk-tier.log", 1 << 20));
+  cs.insert(*makeData("/A/1"));
+  cs.insert(*makeData("/A/2"));
+  BOOST_REQUIRE_EQUAL(cs.getDiskStore()->size(), 1);
+
+  face1->receiveInterest(*makeInterest("/A/1", false, std::nullopt, 1));
+  // while the disk tier is read, the PIT entry has an in-record and an expiry timer
+  Pit& pit = forwarder.getPit();
+  BOOST_REQUIRE_EQUAL(pit.size(), 1);
+  auto pitEntry = pit.find(*makeInterest("/A/1"));
+  BOOST_REQUIRE(pitEntry != nullptr);
+  BOOST_CHECK(pitEntry->hasPendingCsLookup);
+  BOOST_CHECK_EQUAL(pitEntry->getInRecords().size(), 1);
+
+  // a retransmission and an Interest from another face wait for the same lookup
+  face1->receiveInterest(*makeInterest("/A/1", false, std::nullopt, 1));
+  face3->receiveInterest(*makeInterest("/A/1", false, std::nullopt, 3));
+  BOOST_CHECK_EQUAL(pitEntry->getInRecords().size(), 2);
+  // the same Nonce from a different face is a loop
+  face4->receiveInterest(*makeInterest("/A/1", false, std::nullopt, 1));
+  BOOST_CHECK_EQUAL(face4->sentNacks.size(), 1);
+
+  cs.getDiskStore()->flush();
+  this->advanceClocks(1_ms, 5_ms);
+  BOOST_CHECK_EQUAL(face2->sentInterests.size(), 0);
+  BOOST_CHECK_EQUAL(counters.nCsHits, 1);
+  BOOST_CHECK_EQUAL(counters.nCsMisses, 0);
+  BOOST_REQUIRE_EQUAL(face1->sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face1->sentData[0].getName(), "/A/1");
+  BOOST_REQUIRE_EQUAL(face3->sentData.size(), 1);
+  BOOST_CHECK_EQUAL(face3->sentData[0].getName(), "/A/1");
+
+  this->advanceClocks(100_ms, 500_ms);
+  BOOST_CHECK_EQUAL(pit.size(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(InterestWithoutNonce)
 {
   auto face1 = addFace();
@@ -996,6 +1089,88 @@ BOOST_AUTO_TEST_CASE(BadDefaultHopLimit)
   BOOST_CHECK_THROW(cf.parse(config, false, "dummy-config"), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(DeadNonceListStorageOption)
+{
+  ConfigFile cf;
+  forwarder.setConfigFile(cf);
+
+  std::string config = R"CONFIG(
+    forwarder
+    {
+      dead_nonce_list_storage filter
+    }
+  )CONFIG";
+
+  BOOST_TEST(forwarder.getDeadNonceList().getStorage() == DeadNonceListStorage::EXACT);
+
+  cf.parse(config, true, "dummy-config");
+  BOOST_TEST(forwarder.getDeadNonceList().getStorage() == DeadNonceListStorage::EXACT);
+
+  cf.parse(config, false, "dummy-config");
+  BOOST_TEST(forwarder.m_config.deadNonceListStorage == DeadNonceListStorage::FILTER);
+  BOOST_TEST(forwarder.getDeadNonceList().getStorage() == DeadNonceListStorage::FILTER);
+
+  config = R"CONFIG(
+    forwarder
+    {
+    }
+  )CONFIG";
+
+  cf.parse(config, false, "dummy-config");
+  BOOST_TEST(forwarder.getDeadNonceList().getStorage() == DeadNonceListStorage::EXACT);
+
+  config = R"CONFIG(
+    forwarder
+    {
+      dead_nonce_list_storage bloom
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(cf.parse(config, true, "dummy-config"), ConfigFile::Error);
+  BOOST_CHECK_THROW(cf.parse(config, false, "dummy-config"), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(LatencySamplingInterval)
+{
+  ConfigFile cf;
+  forwarder.setConfigFile(cf);
+
+  std::string config = R"CONFIG(
+    forwarder
+    {
+      latency_sampling_interval 8
+    }
+  )CONFIG";
+
+  BOOST_TEST(LatencySampler::getInterval() == LatencySampler::DEFAULT_INTERVAL);
+
+  cf.parse(config, true, "dummy-config");
+  BOOST_TEST(LatencySampler::getInterval() == LatencySampler::DEFAULT_INTERVAL);
+
+  cf.parse(config, false, "dummy-config");
+  BOOST_TEST(forwarder.m_config.latencySamplingInterval == 8);
+  BOOST_TEST(LatencySampler::getInterval() == 8);
+
+  config = R"CONFIG(
+    forwarder
+    {
+    }
+  )CONFIG";
+
+  cf.parse(config, false, "dummy-config");
+  BOOST_TEST(LatencySampler::getInterval() == LatencySampler::DEFAULT_INTERVAL);
+
+  config = R"CONFIG(
+    forwarder
+    {
+      latency_sampling_interval 12
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(cf.parse(config, true, "dummy-config"), ConfigFile::Error);
+  BOOST_CHECK_THROW(cf.parse(config, false, "dummy-config"), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // ProcessConfig
 
 BOOST_AUTO_TEST_SUITE_END() // TestForwarder
@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "mgmt/dataset-change-log.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(Mgmt)
+BOOST_AUTO_TEST_SUITE(TestDatasetChangeLog)
+
+static std::vector<int>
+collectChangesSince(const DatasetChangeLog<int>& log, uint64_t version)
+{
+  std::vector<int> keys;
+  log.forEachChangeSince({log.getEpoch(), version}, [&] (int key) { keys.push_back(key); });
+  return keys;
+}
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  DatasetChangeLog<int> log;
+  BOOST_TEST(log.getVersion() == 1);
+  BOOST_TEST(log.canReportSince({log.getEpoch(), 1}));
+  BOOST_TEST(!log.canReportSince({log.getEpoch(), 0}));
+  BOOST_TEST(!log.canReportSince({log.getEpoch(), 2}));
+  BOOST_TEST(collectChangesSince(log, 1).empty());
+
+  // a version counted by another instance is never reported from
+  DatasetChangeLog<int> other;
+  BOOST_TEST(other.getEpoch() != log.getEpoch());
+  BOOST_TEST(!log.canReportSince({other.getEpoch(), 1}));
+
+  log.markChanged(10);
+  log.markChanged(20);
+  log.markChanged(30);
+  BOOST_TEST(log.getVersion() == 4);
+  BOOST_TEST(collectChangesSince(log, 1) == std::vector<int>({10, 20, 30}),
+             boost::test_tools::per_element());
+  BOOST_TEST(collectChangesSince(log, 3) == std::vector<int>({30}),
+             boost::test_tools::per_element());
+
+  // only the latest change of each key is reported
+  log.markChanged(10);
+  BOOST_TEST(log.getVersion() == 5);
+  BOOST_TEST(collectChangesSince(log, 1) == std::vector<int>({20, 30, 10}),
+             boost::test_tools::per_element());
+  BOOST_TEST(collectChangesSince(log, 4) == std::vector<int>({10}),
+             boost::test_tools::per_element());
+  BOOST_TEST(collectChangesSince(log, 5).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  DatasetChangeLog<int> log(2);
+  log.markChanged(10); // version 2
+  log.markChanged(20); // version 3
+  BOOST_TEST(log.canReportSince({log.getEpoch(), 1}));
+
+  log.markChanged(30); // version 4, drops the change of 10
+  BOOST_TEST(!log.canReportSince({log.getEpoch(), 1}));
+  BOOST_TEST(log.canReportSince({log.getEpoch(), 2}));
+  BOOST_TEST(collectChangesSince(log, 2) == std::vector<int>({20, 30}),
+             boost::test_tools::per_element());
+
+  // changing a retained key does not drop anything
+  log.markChanged(20); // version 5
+  BOOST_TEST(log.canReportSince({log.getEpoch(), 2}));
+  BOOST_TEST(collectChangesSince(log, 2) == std::vector<int>({30, 20}),
+             boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(ExtractPosition)
+{
+  const Name prefix("/localhost/nfd/fib/changes");
+  auto position = extractDatasetPosition(prefix, prefix);
+  BOOST_REQUIRE(position);
+  BOOST_TEST(position->epoch == 0);
+  BOOST_TEST(position->version == 0);
+
+  position = extractDatasetPosition(prefix, Name(prefix).appendNumber(7).appendNumber(42));
+  BOOST_REQUIRE(position);
+  BOOST_TEST(position->epoch == 7);
+  BOOST_TEST(position->version == 42);
+
+  BOOST_CHECK(!extractDatasetPosition(prefix, Name(prefix).appendNumber(42)));
+  BOOST_CHECK(!extractDatasetPosition(prefix, Name(prefix).append("abc").appendNumber(42)));
+  BOOST_CHECK(!extractDatasetPosition(prefix, Name(prefix).appendNumber(7).append("abc")));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDatasetChangeLog
+BOOST_AUTO_TEST_SUITE_END() // Mgmt
+
+} // namespace nfd::tests
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -24,6 +24,7 @@
  */
 
 #include "mgmt/face-manager.hpp"
+#include "core/dataset-delta.hpp"
 #include "face/protocol-factory.hpp"
 
 #include "face-manager-command-fixture.hpp"
@@ -359,6 +360,62 @@ BOOST_AUTO_TEST_CASE(ChannelDataset)
   }
 }
 
+BOOST_AUTO_TEST_CASE(FaceChanges)
+{
+  auto face1 = addFace(REMOVE_LAST_NOTIFICATION);
+  auto face2 = addFace(REMOVE_LAST_NOTIFICATION);
+  auto face3 = addFace(REMOVE_LAST_NOTIFICATION);
+  FaceId faceId3 = face3->getId();
+
+  // a client without a version gets a full snapshot
+  receiveInterest(Interest("/localhost/nfd/faces/changes").setCanBePrefix(true));
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 4);
+  DatasetDeltaHeader header;
+  header.wireDecode(content.elements()[0]);
+  BOOST_TEST(header.isFullSnapshot == true);
+  uint64_t epoch = header.epoch;
+  uint64_t version = header.version;
+
+  // face1 forwards a packet, the MTU of face2 changes, and face3 is destroyed
+  const_cast<PacketCounter&>(face1->getCounters().nInInterests).set(5);
+  static_cast<DummyTransport*>(face2->getTransport())->setMtu(1500);
+  face3->close();
+  advanceClocks(1_ms, 10);
+
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/faces/changes").appendNumber(epoch)
+                           .appendNumber(version))
+                  .setCanBePrefix(true));
+  content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 3);
+  header.wireDecode(content.elements()[0]);
+  BOOST_TEST(header.isFullSnapshot == false);
+  BOOST_TEST(header.version > version);
+  DatasetRemoval removal;
+  removal.wireDecode(content.elements()[1]);
+  BOOST_CHECK(removal.key == DatasetRemoval::Key(uint64_t{faceId3}));
+  // a change of counters alone is not reported
+  ndn::nfd::FaceStatus status(content.elements()[2]);
+  BOOST_TEST(status.getFaceId() == face2->getId());
+  BOOST_TEST(status.getMtu() == 1500);
+  version = header.version;
+
+  // nothing changed since the previous request
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/faces/changes").appendNumber(epoch)
+                           .appendNumber(version))
+                  .setCanBePrefix(true));
+  content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 1);
+  header.wireDecode(content.elements()[0]);
+  BOOST_TEST(header.isFullSnapshot == false);
+  BOOST_TEST(header.version == version);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Datasets
 
 BOOST_AUTO_TEST_SUITE(Notifications)
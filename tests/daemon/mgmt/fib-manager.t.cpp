@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -24,6 +24,7 @@
  */
 
 #include "mgmt/fib-manager.hpp"
+#include "core/dataset-delta.hpp"
 #include "table/fib-entry.hpp"
 
 #include "manager-common-fixture.hpp"
@@ -444,6 +445,94 @@ BOOST_AUTO_TEST_CASE(FibDataset)
   BOOST_TEST(receivedRecords == expectedRecords, boost::test_tools::per_element());
 }
 
+BOOST_AUTO_TEST_CASE(Changes)
+{
+  FaceId face1 = addFace();
+  FaceId face2 = addFace();
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/A").first, *m_faceTable.get(face1), 1);
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/B").first, *m_faceTable.get(face2), 2);
+
+  // a client without a version gets a full snapshot
+  receiveInterest(Interest("/localhost/nfd/fib/changes").setCanBePrefix(true));
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 3);
+  DatasetDeltaHeader header;
+  header.wireDecode(content.elements()[0]);
+  BOOST_CHECK_EQUAL(header.isFullSnapshot, true);
+  BOOST_CHECK_EQUAL(header.epoch, m_manager.m_changeLog.getEpoch());
+  BOOST_CHECK_EQUAL(header.version, m_manager.m_changeLog.getVersion());
+  std::set<Name> prefixes{ndn::nfd::FibEntry(content.elements()[1]).getPrefix(),
+                          ndn::nfd::FibEntry(content.elements()[2]).getPrefix()};
+  BOOST_TEST(prefixes == std::set<Name>({"/A", "/B"}), boost::test_tools::per_element());
+  uint64_t epoch = header.epoch;
+  uint64_t version = header.version;
+
+  m_fib.addOrUpdateNextHop(*m_fib.findExactMatch("/A"), *m_faceTable.get(face2), 3);
+  m_fib.removeNextHop(*m_fib.findExactMatch("/B"), *m_faceTable.get(face2));
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/C").first, *m_faceTable.get(face1), 4);
+
+  // the next request carries the epoch and version, and gets only the changes
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/fib/changes").appendNumber(epoch)
+                           .appendNumber(version))
+                  .setCanBePrefix(true));
+  content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 4);
+  header.wireDecode(content.elements()[0]);
+  BOOST_CHECK_EQUAL(header.isFullSnapshot, false);
+  BOOST_CHECK_GT(header.version, version);
+  ndn::nfd::FibEntry entryA(content.elements()[1]);
+  BOOST_CHECK_EQUAL(entryA.getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(entryA.getNextHopRecords().size(), 2);
+  DatasetRemoval removal;
+  removal.wireDecode(content.elements()[2]);
+  BOOST_CHECK(removal.key == DatasetRemoval::Key(Name("/B")));
+  BOOST_CHECK_EQUAL(ndn::nfd::FibEntry(content.elements()[3]).getPrefix(), "/C");
+
+  // a version that the FIB has not reached yet
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/fib/changes").appendNumber(epoch)
+                           .appendNumber(header.version + 100))
+                  .setCanBePrefix(true));
+  content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 3);
+  header.wireDecode(content.elements()[0]);
+  BOOST_CHECK_EQUAL(header.isFullSnapshot, true);
+
+  // a version that is current, but was counted by another NFD instance before a restart
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/fib/changes").appendNumber(epoch + 1)
+                           .appendNumber(header.version))
+                  .setCanBePrefix(true));
+  content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 3);
+  header.wireDecode(content.elements()[0]);
+  BOOST_CHECK_EQUAL(header.isFullSnapshot, true);
+  BOOST_CHECK_EQUAL(header.epoch, epoch);
+}
+
+BOOST_AUTO_TEST_CASE(ChangesMalformedVersion)
+{
+  Name name("/localhost/nfd/fib/changes/not-a-number");
+  name.appendNumber(1);
+  receiveInterest(Interest(name).setCanBePrefix(true));
+
+  ControlResponse expectedResponse(400, "Malformed epoch or version");
+  BOOST_CHECK_EQUAL(checkResponse(0, name, expectedResponse, tlv::ContentType_Nack),
+                    CheckResponseResult::OK);
+
+  // a version without an epoch
+  m_responses.clear();
+  name = Name("/localhost/nfd/fib/changes").appendNumber(1);
+  receiveInterest(Interest(name).setCanBePrefix(true));
+  BOOST_CHECK_EQUAL(checkResponse(0, name, expectedResponse, tlv::ContentType_Nack),
+                    CheckResponseResult::OK);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // List
 
 BOOST_AUTO_TEST_SUITE_END() // TestFibManager
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -27,6 +27,8 @@
 #include "core/version.hpp"
 
 #include "manager-common-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "tests/daemon/face/dummy-transport.hpp"
 
 namespace nfd::tests {
 
@@ -41,6 +43,11 @@ protected:
     setTopPrefix();
   }
 
+  ~ForwarderStatusManagerFixture()
+  {
+    LatencySampler::setInterval(LatencySampler::DEFAULT_INTERVAL);
+  }
+
 protected:
   FaceTable m_faceTable;
   Forwarder m_forwarder;
@@ -106,6 +113,40 @@ BOOST_AUTO_TEST_CASE(GeneralStatusDataset)
   BOOST_CHECK_EQUAL(status.getNUnsatisfiedInterests(), m_forwarder.getCounters().nUnsatisfiedInterests);
 }
 
+BOOST_AUTO_TEST_CASE(LatencyDataset)
+{
+  LatencySampler::setInterval(1);
+  auto face = make_shared<DummyFace>();
+  m_faceTable.add(face);
+  m_forwarder.onIncomingInterest(*makeInterest("/latency"), FaceEndpoint(*face));
+  static_cast<DummyTransport*>(face->getTransport())->receivePacket(makeInterest("/rx")->wireEncode());
+
+  receiveInterest(Interest("/localhost/nfd/status/latency").setCanBePrefix(true));
+
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements_size(), N_FORWARDER_STAGES + 1);
+
+  std::map<std::string, LatencyStatus> items;
+  for (size_t i = 0; i < N_FORWARDER_STAGES; ++i) {
+    LatencyStatus item;
+    item.wireDecode(content.elements()[i]);
+    BOOST_CHECK(!item.faceId);
+    items[item.label] = item;
+  }
+  BOOST_TEST(items.at("incoming-interest").histogram.getCount() == 1);
+  BOOST_TEST(items.at("pit-insert").histogram.getCount() == 1);
+  BOOST_TEST(items.at("cs-lookup").histogram.getCount() == 1);
+  BOOST_TEST(items.at("strategy-interest").histogram.getCount() == 1);
+  BOOST_TEST(items.at("incoming-data").histogram.getCount() == 0);
+
+  LatencyStatus rx;
+  rx.wireDecode(content.elements().back());
+  BOOST_TEST(rx.label == "face-rx");
+  BOOST_CHECK(rx.faceId == face->getId());
+  BOOST_TEST(rx.histogram.getCount() == 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestForwarderStatusManager
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -24,6 +24,7 @@
  */
 
 #include "mgmt/rib-manager.hpp"
+#include "core/dataset-delta.hpp"
 
 #include "manager-common-fixture.hpp"
 #include "tests/daemon/rib/fib-updates-common.hpp"
@@ -428,7 +429,8 @@ BOOST_AUTO_TEST_CASE(Expiration)
   auto paramsUnregister = makeRegisterParameters("/test-expiry", 9527);
   receiveInterest(makeControlCommandRequest(REG_REQUEST, paramsRegister));
 
-  advanceClocks(55_ms);
+  // expiration is deferred to the end of its bucket
+  advanceClocks(55_ms + rib::Rib::ROUTE_EXPIRATION_GRANULARITY);
   BOOST_REQUIRE_EQUAL(m_fibUpdater.updates.size(), 2); // the registered route has expired
   BOOST_CHECK_EQUAL(m_fibUpdater.updates.front(),
                     rib::FibUpdate::createAddUpdate("/test-expiry", 9527, 10));
@@ -627,6 +629,49 @@ BOOST_FIXTURE_TEST_CASE(RibDataset, UnauthorizedRibManagerFixture)
   BOOST_TEST(receivedRecords == expectedRecords, boost::test_tools::per_element());
 }
 
+BOOST_FIXTURE_TEST_CASE(RibChanges, UnauthorizedRibManagerFixture)
+{
+  rib::Route route1;
+  route1.faceId = 1;
+  route1.cost = 10;
+  rib::Route route2;
+  route2.faceId = 2;
+  route2.cost = 20;
+  m_rib.insert("/A", route1);
+  m_rib.insert("/B", route2);
+
+  // a client without a version gets a full snapshot
+  receiveInterest(*makeInterest("/localhost/nfd/rib/changes", true));
+  Block content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 3);
+  DatasetDeltaHeader header;
+  header.wireDecode(content.elements()[0]);
+  BOOST_TEST(header.isFullSnapshot == true);
+  uint64_t epoch = header.epoch;
+  uint64_t version = header.version;
+
+  route1.cost = 15;
+  m_rib.insert("/A", route1); // updates the existing route
+  m_rib.erase("/B", route2);
+
+  m_responses.clear();
+  receiveInterest(*makeInterest(Name("/localhost/nfd/rib/changes").appendNumber(epoch)
+                                .appendNumber(version), true));
+  content = concatenateResponses();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 3);
+  header.wireDecode(content.elements()[0]);
+  BOOST_TEST(header.isFullSnapshot == false);
+  ndn::nfd::RibEntry entryA(content.elements()[1]);
+  BOOST_TEST(entryA.getName() == "/A");
+  BOOST_REQUIRE_EQUAL(entryA.getRoutes().size(), 1);
+  BOOST_TEST(entryA.getRoutes().front().getCost() == 15);
+  DatasetRemoval removal;
+  removal.wireDecode(content.elements()[2]);
+  BOOST_CHECK(removal.key == DatasetRemoval::Key(Name("/B")));
+}
+
 BOOST_FIXTURE_TEST_SUITE(FaceMonitor, LocalhostAuthorizedRibManagerFixture)
 
 BOOST_AUTO_TEST_CASE(FetchActiveFacesEvent)
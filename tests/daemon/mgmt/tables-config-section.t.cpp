@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -151,6 +151,104 @@ BOOST_AUTO_TEST_CASE(InvalidValue)
 
 BOOST_AUTO_TEST_SUITE_END() // CsMaxPackets
 
+BOOST_AUTO_TEST_SUITE(CsMaxBytes)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes 4096
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_REQUIRE_EQUAL(cs.getByteLimit(), 4096);
+
+  // omitting the option restores the default, which is unlimited
+  BOOST_REQUIRE_NO_THROW(runConfig("tables\n{\n}\n", false));
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), std::numeric_limits<size_t>::max());
+}
+
+BOOST_AUTO_TEST_CASE(Valid)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes 1048576
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NE(cs.getByteLimit(), 1048576);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK_NE(cs.getByteLimit(), 1048576);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), 1048576);
+
+  tablesConfig.ensureConfigured();
+  BOOST_CHECK_EQUAL(cs.getByteLimit(), 1048576);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidValue)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_max_bytes invalid
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsMaxBytes
+
+BOOST_AUTO_TEST_CASE(CsDiskTier)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_disk_path )CONFIG" UNIT_TESTS_TMPDIR R"CONFIG(/tables-config-cs-disk.log
+      cs_disk_max_bytes 65536
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  BOOST_CHECK(cs.getDiskStore() == nullptr);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  const cs::DiskStore* diskStore = cs.getDiskStore();
+  BOOST_REQUIRE(diskStore != nullptr);
+  BOOST_CHECK_EQUAL(diskStore->getMaxBytes(), 65536);
+
+  // unchanged options keep the existing DiskStore
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  BOOST_CHECK_EQUAL(cs.getDiskStore(), diskStore);
+
+  // omitting cs_disk_path disables the disk tier
+  BOOST_REQUIRE_NO_THROW(runConfig("tables\n{\n}\n", false));
+  BOOST_CHECK(cs.getDiskStore() == nullptr);
+
+  // an unusable path is rejected in dry-run too, and before strategy choices are applied
+  const std::string BAD_CONFIG = R"CONFIG(
+    tables
+    {
+      cs_disk_path )CONFIG" UNIT_TESTS_TMPDIR R"CONFIG(/nonexistent/cs.log
+      strategy_choice
+      {
+        /a /tables-config-section-strategy-P
+      }
+    }
+  )CONFIG";
+  BOOST_CHECK_THROW(runConfig(BAD_CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(BAD_CONFIG, false), ConfigFile::Error);
+  BOOST_CHECK(cs.getDiskStore() == nullptr);
+  BOOST_CHECK_EQUAL(strategyChoice.findEffectiveStrategy("/a").getInstanceName(), defaultStrategy);
+}
+
 BOOST_AUTO_TEST_SUITE(CsPolicy)
 
 BOOST_AUTO_TEST_CASE(Default)
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rib/fib-update-channel.hpp"
+#include "common/global.hpp"
+#include "fw/face-table.hpp"
+#include "table/fib.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/rib-io-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+
+#include <boost/asio/post.hpp>
+
+#include <thread>
+
+namespace nfd::tests {
+
+using rib::FibUpdate;
+using rib::FibUpdateChannel;
+
+class FibUpdateChannelFixture : public RibIoFixture
+{
+protected:
+  FibUpdateChannelFixture()
+  {
+    faceTable.add(face1);
+  }
+
+  const fib::NextHop*
+  findNextHop(const Name& prefix, const Face& face) const
+  {
+    const fib::Entry* entry = fib.findExactMatch(prefix);
+    if (entry == nullptr) {
+      return nullptr;
+    }
+    for (const auto& nh : entry->getNextHops()) {
+      if (&nh.getFace() == &face) {
+        return &nh;
+      }
+    }
+    return nullptr;
+  }
+
+protected:
+  NameTree nameTree;
+  Fib fib{nameTree};
+  FaceTable faceTable;
+  shared_ptr<Face> face1 = make_shared<DummyFace>();
+  FibUpdateChannel channel{fib, faceTable};
+};
+
+BOOST_AUTO_TEST_SUITE(Rib)
+BOOST_FIXTURE_TEST_SUITE(TestFibUpdateChannel, FibUpdateChannelFixture)
+
+BOOST_AUTO_TEST_CASE(Instance)
+{
+  BOOST_CHECK_EQUAL(FibUpdateChannel::get(), &channel);
+  BOOST_CHECK_THROW(FibUpdateChannel(fib, faceTable), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(Apply)
+{
+  FaceId faceId = face1->getId();
+  Name tooLong;
+  for (size_t i = 0; i <= Fib::getMaxDepth(); ++i) {
+    tooLong.append("A");
+  }
+
+  auto responses = channel.apply({
+    FibUpdate::createAddUpdate("/a", faceId, 10),
+    FibUpdate::createAddUpdate("/b", faceId, 20),
+    FibUpdate::createAddUpdate("/c", faceId + 1, 30),
+    FibUpdate::createAddUpdate(tooLong, faceId, 40),
+    FibUpdate::createRemoveUpdate("/b", faceId),
+    FibUpdate::createRemoveUpdate("/d", faceId),
+    FibUpdate::createRemoveUpdate("/a", faceId + 1),
+  });
+
+  std::vector<uint32_t> codes;
+  for (const auto& response : responses) {
+    codes.push_back(response.getCode());
+  }
+  std::vector<uint32_t> expectedCodes{200, 200, 410, 414, 200, 200, 200};
+  BOOST_TEST(codes == expectedCodes, boost::test_tools::per_element());
+
+  const fib::NextHop* nh = findNextHop("/a", *face1);
+  BOOST_REQUIRE(nh != nullptr);
+  BOOST_CHECK_EQUAL(nh->getCost(), 10);
+  BOOST_CHECK(fib.findExactMatch("/b") == nullptr);
+  BOOST_CHECK(fib.findExactMatch("/c") == nullptr);
+  BOOST_CHECK_EQUAL(fib.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Send)
+{
+  auto mainThreadId = std::this_thread::get_id();
+  FaceId faceId = face1->getId();
+  bool hasResponse = false;
+
+  boost::asio::post(getRibIoService(), [&] {
+    channel.send({FibUpdate::createAddUpdate("/a", faceId, 10),
+                  FibUpdate::createAddUpdate("/b", faceId + 1, 20)},
+      [&] (const auto& updates, const auto& responses) {
+        BOOST_CHECK(std::this_thread::get_id() != mainThreadId);
+        BOOST_REQUIRE_EQUAL(updates.size(), 2);
+        BOOST_REQUIRE_EQUAL(responses.size(), 2);
+        BOOST_CHECK_EQUAL(updates.front().name, "/a");
+        BOOST_CHECK_EQUAL(responses.front().getCode(), 200);
+        BOOST_CHECK_EQUAL(updates.back().name, "/b");
+        BOOST_CHECK_EQUAL(responses.back().getCode(), 410);
+        hasResponse = true;
+      });
+  });
+
+  // the update is applied on the main thread, then the response is handed back to the RIB thread
+  for (int i = 0; i < 4 && !hasResponse; ++i) {
+    poll();
+  }
+  BOOST_CHECK(hasResponse);
+  BOOST_CHECK(findNextHop("/a", *face1) != nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFibUpdateChannel
+BOOST_AUTO_TEST_SUITE_END() // Rib
+
+} // namespace nfd::tests
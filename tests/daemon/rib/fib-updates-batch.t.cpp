@@ -0,0 +1,207 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rib/rib.hpp"
+
+#include "tests/test-common.hpp"
+#include "fib-updates-common.hpp"
+
+#include <algorithm>
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(Rib)
+BOOST_FIXTURE_TEST_SUITE(TestFibUpdates, FibUpdatesFixture)
+BOOST_AUTO_TEST_SUITE(Batch)
+
+BOOST_AUTO_TEST_CASE(CoalesceSameFace)
+{
+  int nSuccesses = 0;
+  auto registerRoute = [&] (const Name& name, uint64_t faceId) {
+    rib.beginApplyUpdate({rib::RibUpdate::REGISTER, name, createRoute(faceId, 0, 10, 0)},
+                         [&] { ++nSuccesses; }, nullptr);
+  };
+
+  registerRoute("/a", 1); // sent immediately
+  registerRoute("/b", 1);
+  registerRoute("/c", 2); // different face
+  registerRoute("/d", 1);
+  registerRoute("/b/x", 1); // overlaps with /b
+  registerRoute("/e", 1);
+  pollIo();
+
+  // /b, /d, and /e are applied in one batch, ahead of /c, which precedes /b/x
+  std::vector<Name> names;
+  for (const auto& update : getFibUpdates()) {
+    names.push_back(update.name);
+  }
+  std::vector<Name> expected{"/a", "/b", "/d", "/e", "/c", "/b/x"};
+  BOOST_TEST(names == expected, boost::test_tools::per_element());
+
+  BOOST_TEST(nSuccesses == 6);
+  BOOST_TEST(rib.size() == 6);
+  BOOST_TEST(rib.find("/b/x")->second->getParent()->getName() == "/b");
+}
+
+BOOST_AUTO_TEST_CASE(RemoveFace)
+{
+  insertRoute("/", 1, 0, 5, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  insertRoute("/a", 2, 0, 10, 0);
+  insertRoute("/a/b", 2, 0, 10, 0);
+  insertRoute("/c", 2, 0, 10, 0);
+  insertRoute("/d", 2, 0, 10, 0);
+  clearFibUpdates();
+
+  // /a, /c, and /d are removed in one batch, then /a/b;
+  // the nexthops inherited from / are removed along with the erased entries
+  destroyFace(2);
+
+  BOOST_TEST(rib.size() == 1);
+  BOOST_CHECK(rib.find("/a") == rib.end());
+  BOOST_CHECK(rib.find("/a/b") == rib.end());
+
+  const auto& updates = getSortedFibUpdates();
+  BOOST_REQUIRE_EQUAL(updates.size(), 4);
+  std::vector<Name> names;
+  for (const auto& update : updates) {
+    BOOST_TEST(update.faceId == 1);
+    BOOST_TEST(update.action == FibUpdate::REMOVE_NEXTHOP);
+    names.push_back(update.name);
+  }
+  std::vector<Name> expected{"/a", "/a/b", "/c", "/d"};
+  BOOST_TEST(names == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(IgnoreResponsesToFailedBatch)
+{
+  rib::RibUpdateBatch batch(1);
+  batch.add({rib::RibUpdate::REGISTER, "/a", createRoute(1, 0, 10, 0)});
+  batch.add({rib::RibUpdate::REGISTER, "/b", createRoute(1, 0, 10, 0)});
+
+  // the failure of /a fails the batch; the same batch is sent again before the response
+  // to the first /b arrives, which must not be taken for the response to the second /b
+  int nFailures = 0;
+  int nSuccesses = 0;
+  fibUpdater.mockSuccess = false;
+  fibUpdater.mockErrorCode = 410;
+  fibUpdater.computeAndSendFibUpdates(batch, [] (auto&&) { BOOST_ERROR("unexpected success"); },
+    [&] (uint32_t code, const std::string&) {
+      BOOST_CHECK_EQUAL(code, 410);
+      ++nFailures;
+      fibUpdater.mockSuccess = true;
+      fibUpdater.computeAndSendFibUpdates(batch, [&] (auto&&) { ++nSuccesses; },
+        [] (uint32_t, const std::string&) { BOOST_ERROR("unexpected failure"); });
+    });
+  pollIo();
+
+  BOOST_CHECK_EQUAL(nFailures, 1);
+  BOOST_CHECK_EQUAL(nSuccesses, 1);
+  BOOST_CHECK_EQUAL(getFibUpdates().size(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(ExpireRoutes)
+{
+  auto registerRoute = [&] (const Name& name, uint64_t faceId, time::nanoseconds lifetime) {
+    auto route = createRoute(faceId, 0, 10, 0);
+    route.expires = time::steady_clock::now() + lifetime;
+    rib.beginApplyUpdate({rib::RibUpdate::REGISTER, name, route}, nullptr, nullptr);
+    pollIo();
+  };
+
+  registerRoute("/a", 1, 1_s);
+  registerRoute("/b", 2, 1_s + 10_ms);
+  registerRoute("/c", 1, 10_s);
+  registerRoute("/d", 1, 1_s);
+  registerRoute("/d", 1, 10_s); // renewed
+  clearFibUpdates();
+
+  advanceClocks(900_ms);
+  BOOST_TEST(getFibUpdates().empty());
+  BOOST_TEST(rib.size() == 4);
+
+  // /a and /b expire together, /c and /d are still valid
+  advanceClocks(300_ms);
+  BOOST_TEST(rib.size() == 2);
+  BOOST_CHECK(rib.find("/a") == rib.end());
+  BOOST_CHECK(rib.find("/b") == rib.end());
+
+  const auto& updates = getSortedFibUpdates();
+  BOOST_REQUIRE_EQUAL(updates.size(), 2);
+  BOOST_CHECK_EQUAL(updates.front(), FibUpdate::createRemoveUpdate("/a", 1));
+  BOOST_CHECK_EQUAL(updates.back(), FibUpdate::createRemoveUpdate("/b", 2));
+}
+
+BOOST_AUTO_TEST_CASE(RenewRouteManyTimes)
+{
+  auto route = createRoute(1, 0, 10, 0);
+  // renewals move the route between buckets and back, or leave it in the same bucket
+  for (int i = 0; i < 100; ++i) {
+    route.expires = time::steady_clock::now() + 1_s + (i % 10) * rib::Rib::ROUTE_EXPIRATION_GRANULARITY;
+    rib.beginApplyUpdate({rib::RibUpdate::REGISTER, "/a", route}, nullptr, nullptr);
+    pollIo();
+  }
+  clearFibUpdates();
+
+  BOOST_REQUIRE_EQUAL(rib.m_expirationBuckets.size(), 1);
+  BOOST_CHECK_EQUAL(rib.m_expirationBuckets.begin()->second.size(), 1);
+  BOOST_CHECK_EQUAL(rib.m_expiringRoutes.size(), 1);
+
+  // expire the route without running the pending event and the FIB updates
+  m_steadyClock->advance(3_s);
+  rib.expireRoutes();
+  size_t nUnregisters = 0;
+  for (const auto* queue : {&rib.m_inProgressUpdates, &rib.m_updateQueue}) {
+    nUnregisters += std::count_if(queue->begin(), queue->end(), [] (const auto& item) {
+      return item.update.action == rib::RibUpdate::UNREGISTER;
+    });
+  }
+  BOOST_CHECK_EQUAL(nUnregisters, 1);
+  BOOST_CHECK(rib.m_expirationBuckets.empty());
+  BOOST_CHECK(rib.m_expiringRoutes.empty());
+
+  pollIo();
+  BOOST_TEST(rib.size() == 0);
+  BOOST_REQUIRE_EQUAL(getFibUpdates().size(), 1);
+  BOOST_CHECK_EQUAL(getFibUpdates().front(), FibUpdate::createRemoveUpdate("/a", 1));
+}
+
+BOOST_AUTO_TEST_CASE(EraseExpiringRoute)
+{
+  auto route = createRoute(1, 0, 10, 0);
+  route.expires = time::steady_clock::now() + 1_s;
+  rib.beginApplyUpdate({rib::RibUpdate::REGISTER, "/a", route}, nullptr, nullptr);
+  pollIo();
+  BOOST_CHECK_EQUAL(rib.m_expiringRoutes.size(), 1);
+
+  eraseRoute("/a", 1, 0);
+  BOOST_CHECK(rib.m_expirationBuckets.empty());
+  BOOST_CHECK(rib.m_expiringRoutes.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Batch
+BOOST_AUTO_TEST_SUITE_END() // TestFibUpdates
+BOOST_AUTO_TEST_SUITE_END() // Rib
+
+} // namespace nfd::tests
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -82,13 +82,13 @@ private:
              uint32_t nTimeouts)
   {
     updates.push_back(update);
-    boost::asio::defer(getGlobalIoService(), [=] {
+    boost::asio::defer(getGlobalIoService(), [=, generation = m_generation] {
       if (mockSuccess) {
-        onUpdateSuccess(update, onSuccess, onFailure);
+        onUpdateSuccess(update, generation, onSuccess, onFailure);
       }
       else {
-        ndn::mgmt::ControlResponse resp(504, "mocked failure");
-        onUpdateError(update, onSuccess, onFailure, resp, nTimeouts);
+        ndn::mgmt::ControlResponse resp(mockErrorCode, "mocked failure");
+        onUpdateError(update, generation, onSuccess, onFailure, resp, nTimeouts);
       }
     });
   }
@@ -96,9 +96,10 @@ private:
 public:
   FibUpdateList updates;
   bool mockSuccess = true;
+  uint32_t mockErrorCode = 504;
 };
 
-class FibUpdatesFixture : public GlobalIoFixture, public KeyChainFixture
+class FibUpdatesFixture : public GlobalIoTimeFixture, public KeyChainFixture
 {
 public:
   void
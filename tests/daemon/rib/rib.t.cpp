@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2025,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -101,6 +101,43 @@ BOOST_AUTO_TEST_CASE(Children)
   BOOST_CHECK_EQUAL((rib.find(name3)->second)->getParent()->getName(), name4);
 }
 
+BOOST_AUTO_TEST_CASE(ChildrenOfNewEntry)
+{
+  rib::Rib rib;
+  rib.insert("/a/b/c", createRoute(1, 20));
+  rib.insert("/a/b/c/d", createRoute(2, 20));
+  rib.insert("/a/b/e", createRoute(3, 20));
+  rib.insert("/a/f", createRoute(4, 20));
+  rib.insert("/g", createRoute(5, 20));
+
+  auto getChildNames = [&] (const Name& name) {
+    std::vector<Name> names;
+    for (const auto& child : rib.find(name)->second->getChildren()) {
+      names.push_back(child->getName());
+    }
+    return names;
+  };
+
+  // only the topmost entries under /a are adopted, their descendants are skipped
+  rib.insert("/a", createRoute(6, 20));
+  std::vector<Name> expected{"/a/b/c", "/a/b/e", "/a/f"};
+  BOOST_TEST(getChildNames("/a") == expected, boost::test_tools::per_element());
+  BOOST_CHECK(rib.find("/a")->second->getParent() == nullptr);
+
+  rib.insert("/a/b", createRoute(7, 20));
+  expected = {"/a/f", "/a/b"};
+  BOOST_TEST(getChildNames("/a") == expected, boost::test_tools::per_element());
+  expected = {"/a/b/c", "/a/b/e"};
+  BOOST_TEST(getChildNames("/a/b") == expected, boost::test_tools::per_element());
+  expected = {"/a/b/c/d"};
+  BOOST_TEST(getChildNames("/a/b/c") == expected, boost::test_tools::per_element());
+
+  rib.erase("/a/b", createRoute(7, 20));
+  expected = {"/a/f", "/a/b/c", "/a/b/e"};
+  BOOST_TEST(getChildNames("/a") == expected, boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(rib.find("/a/b/e")->second->getParent()->getName(), "/a");
+}
+
 BOOST_AUTO_TEST_CASE(EraseFace)
 {
   rib::Rib rib;
@@ -0,0 +1,222 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-disk-store.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+#include <boost/asio/post.hpp>
+
+#include <future>
+
+namespace nfd::tests {
+
+using cs::DiskStore;
+
+class DiskStoreFixture : public GlobalIoTimeFixture
+{
+protected:
+  shared_ptr<Data>
+  makeDataWithContent(const Name& name, size_t contentSize = 100)
+  {
+    auto data = makeData(name);
+    std::vector<uint8_t> content(contentSize, 0xBB);
+    data->setContent(content);
+    data->wireEncode();
+    return data;
+  }
+
+  /**
+   * \brief Waits for an asynchronous DiskStore::find to complete.
+   * \return the Data packet, or nullptr if there is no match or it cannot be read
+   */
+  shared_ptr<const Data>
+  find(DiskStore& store, const Interest& interest)
+  {
+    shared_ptr<const Data> found;
+    bool hasResult = false;
+    bool isPending = store.find(interest, [&] (auto data, auto freshUntil) {
+      found = std::move(data);
+      lastFreshUntil = freshUntil;
+      hasResult = true;
+    });
+    if (isPending) {
+      BOOST_CHECK(!hasResult);
+      store.flush();
+      advanceClocks(1_ms);
+      BOOST_CHECK(hasResult);
+    }
+    return found;
+  }
+
+protected:
+  time::steady_clock::time_point lastFreshUntil;
+  static inline const std::string path{UNIT_TESTS_TMPDIR "/cs-disk-store.log"};
+};
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_FIXTURE_TEST_SUITE(TestCsDiskStore, DiskStoreFixture)
+
+BOOST_AUTO_TEST_CASE(InsertFind)
+{
+  DiskStore store(path, 1 << 20);
+  BOOST_CHECK_EQUAL(store.size(), 0);
+
+  auto dataA = makeDataWithContent("/A/1");
+  auto dataB = makeDataWithContent("/B");
+  auto freshUntil = time::steady_clock::now() + 1_s;
+  store.insert(*dataA, freshUntil);
+  store.insert(*dataB, freshUntil);
+  store.insert(*dataB, freshUntil);
+  BOOST_CHECK_EQUAL(store.size(), 2);
+
+  auto found = find(store, *makeInterest("/A/1"));
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->wireEncode(), dataA->wireEncode());
+  BOOST_CHECK(lastFreshUntil == freshUntil);
+
+  BOOST_CHECK(find(store, *makeInterest("/A")) == nullptr);
+  BOOST_CHECK(find(store, *makeInterest("/A", true)) != nullptr);
+  BOOST_CHECK(find(store, *makeInterest(dataB->getFullName())) != nullptr);
+  BOOST_CHECK(find(store, *makeInterest("/C", true)) == nullptr);
+
+  // MustBeFresh
+  auto interest = makeInterest("/B");
+  interest->setMustBeFresh(true);
+  BOOST_CHECK(find(store, *interest) != nullptr);
+  advanceClocks(2_s);
+  BOOST_CHECK(find(store, *interest) == nullptr);
+  interest->setMustBeFresh(false);
+  BOOST_CHECK(find(store, *interest) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(WrapAround)
+{
+  auto data1 = makeDataWithContent("/1");
+  const size_t packetSize = data1->wireEncode().size();
+  // room for three packets
+  DiskStore store(path, packetSize * 3 + packetSize / 2);
+  auto freshUntil = time::steady_clock::now() + 1_s;
+
+  store.insert(*data1, freshUntil);
+  store.insert(*makeDataWithContent("/2"), freshUntil);
+  store.insert(*makeDataWithContent("/3"), freshUntil);
+  BOOST_CHECK_EQUAL(store.size(), 3);
+
+  // overwrites /1 at the beginning of the file
+  store.insert(*makeDataWithContent("/4"), freshUntil);
+  BOOST_CHECK_EQUAL(store.size(), 3);
+  BOOST_CHECK(find(store, *makeInterest("/1")) == nullptr);
+  for (const char* name : {"/2", "/3", "/4"}) {
+    auto found = find(store, *makeInterest(name));
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK_EQUAL(found->getName(), Name(name));
+  }
+
+  // a larger packet overwrites both /2 and /3
+  store.insert(*makeDataWithContent("/5", 100 + packetSize), freshUntil);
+  BOOST_CHECK_EQUAL(store.size(), 2);
+  BOOST_CHECK(find(store, *makeInterest("/2")) == nullptr);
+  BOOST_CHECK(find(store, *makeInterest("/3")) == nullptr);
+  BOOST_CHECK(find(store, *makeInterest("/4")) != nullptr);
+  BOOST_CHECK(find(store, *makeInterest("/5")) != nullptr);
+
+  // packets larger than the file are not stored
+  store.insert(*makeDataWithContent("/6", packetSize * 4), freshUntil);
+  BOOST_CHECK_EQUAL(store.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  DiskStore store(path, 1 << 20);
+  auto freshUntil = time::steady_clock::now() + 1_s;
+  store.insert(*makeDataWithContent("/A/1"), freshUntil);
+  store.insert(*makeDataWithContent("/A/2"), freshUntil);
+  store.insert(*makeDataWithContent("/A/3"), freshUntil);
+  store.insert(*makeDataWithContent("/B/1"), freshUntil);
+
+  BOOST_CHECK_EQUAL(store.erase("/A", 2), 2);
+  BOOST_CHECK_EQUAL(store.size(), 2);
+  BOOST_CHECK_EQUAL(store.erase("/A", 2), 1);
+  BOOST_CHECK_EQUAL(store.erase("/C", 2), 0);
+  BOOST_CHECK_EQUAL(store.size(), 1);
+  BOOST_CHECK(find(store, *makeInterest("/B/1")) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(PendingWritesLimit)
+{
+  DiskStore store(path, 1 << 20);
+  auto freshUntil = time::steady_clock::now() + 1_s;
+
+  // stall the worker, so that writes accumulate
+  std::promise<void> release;
+  boost::asio::post(store.m_ioWorker, [f = release.get_future().share()] { f.wait(); });
+
+  for (size_t i = 0; i <= DiskStore::MAX_PENDING_WRITES; ++i) {
+    store.insert(*makeDataWithContent(Name("/A").appendNumber(i)), freshUntil);
+  }
+  BOOST_CHECK_EQUAL(store.getNPendingWrites(), DiskStore::MAX_PENDING_WRITES);
+  BOOST_CHECK_EQUAL(store.size(), DiskStore::MAX_PENDING_WRITES);
+  BOOST_CHECK(find(store, *makeInterest(Name("/A").appendNumber(DiskStore::MAX_PENDING_WRITES))) == nullptr);
+
+  release.set_value();
+  store.flush();
+  BOOST_CHECK_EQUAL(store.getNPendingWrites(), 0);
+  store.insert(*makeDataWithContent("/B"), freshUntil);
+  BOOST_CHECK_EQUAL(store.size(), DiskStore::MAX_PENDING_WRITES + 1);
+  BOOST_CHECK(find(store, *makeInterest("/B")) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(FindAfterDestruction)
+{
+  auto data = makeDataWithContent("/A");
+  shared_ptr<const Data> found;
+  {
+    DiskStore store(path, 1 << 20);
+    store.insert(*data, time::steady_clock::now() + 1_s);
+    BOOST_CHECK(store.find(*makeInterest("/A"), [&] (auto d, auto) { found = std::move(d); }));
+  }
+
+  // the destructor completes the pending read, whose callback is still delivered
+  BOOST_CHECK(found == nullptr);
+  advanceClocks(1_ms);
+  BOOST_REQUIRE(found != nullptr);
+  BOOST_CHECK_EQUAL(found->wireEncode(), data->wireEncode());
+}
+
+BOOST_AUTO_TEST_CASE(OpenError)
+{
+  BOOST_CHECK_THROW(DiskStore(UNIT_TESTS_TMPDIR "/nonexistent/cs-disk-store.log", 1024),
+                    DiskStore::Error);
+  BOOST_CHECK_THROW(DiskStore::checkPath(UNIT_TESTS_TMPDIR "/nonexistent/cs-disk-store.log"),
+                    DiskStore::Error);
+  BOOST_CHECK_NO_THROW(DiskStore::checkPath(path));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsDiskStore
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace nfd::tests
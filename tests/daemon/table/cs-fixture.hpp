@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -81,7 +81,11 @@ protected:
               check(0);
             });
 
-    // current Cs::find implementation is synchronous
+    // Cs::find is synchronous unless the lookup continues in the disk tier
+    if (!hasResult && cs.getDiskStore() != nullptr) {
+      cs.getDiskStore()->flush();
+      advanceClocks(1_ms);
+    }
     BOOST_CHECK(hasResult);
   }
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -79,6 +79,41 @@ BOOST_FIXTURE_TEST_CASE(EvictOne, CsFixture)
   CHECK_CS_FIND(0);
 }
 
+BOOST_FIXTURE_TEST_CASE(EvictByteLimit, CsFixture)
+{
+  cs.setPolicy(make_unique<cs::LruPolicy>());
+  cs.setLimit(100);
+
+  insert(1, "/A");
+  const size_t entrySize = cs.sizeInBytes();
+  BOOST_REQUIRE_GT(entrySize, 0);
+  cs.setByteLimit(entrySize * 2);
+
+  insert(2, "/B");
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.sizeInBytes(), entrySize * 2);
+
+  // use A
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+
+  // evict B
+  insert(3, "/C");
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.sizeInBytes(), entrySize * 2);
+  startInterest("/B");
+  CHECK_CS_FIND(0);
+
+  // lowering the limit evicts A
+  cs.setByteLimit(entrySize);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.sizeInBytes(), entrySize);
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+  startInterest("/C");
+  CHECK_CS_FIND(3);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsLru
 BOOST_AUTO_TEST_SUITE_END() // Table
 
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -94,6 +94,36 @@ BOOST_FIXTURE_TEST_CASE(Refresh, CsFixture)
   CHECK_CS_FIND(0);
 }
 
+BOOST_FIXTURE_TEST_CASE(EvictByteLimit, CsFixture)
+{
+  cs.setPolicy(make_unique<cs::PriorityFifoPolicy>());
+  cs.setLimit(100);
+
+  auto setFreshness = [] (Data& data) { data.setFreshnessPeriod(10_ms); };
+  insert(1, "/A", setFreshness);
+  const size_t entrySize = cs.sizeInBytes();
+  BOOST_REQUIRE_GT(entrySize, 0);
+  cs.setByteLimit(entrySize * 2);
+
+  insert(2, "/B", setFreshness);
+  advanceClocks(11_ms);
+  insert(3, "/C", setFreshness);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.sizeInBytes(), entrySize * 2);
+
+  // evict /A (stale, inserted first)
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+
+  // evict /B (stale) before /C (fresh)
+  cs.setByteLimit(entrySize);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  startInterest("/B");
+  CHECK_CS_FIND(0);
+  startInterest("/C");
+  CHECK_CS_FIND(3);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestCsPriorityFifo
 BOOST_AUTO_TEST_SUITE_END() // Table
 
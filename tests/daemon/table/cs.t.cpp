@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -61,6 +61,49 @@ BOOST_AUTO_TEST_CASE(ExactName_CanBePrefix)
   CHECK_CS_FIND(2);
 }
 
+BOOST_AUTO_TEST_CASE(ExactName_SameNameMultipleData)
+{
+  Name n1 = insert(1, "/A");
+  insert(2, "/A");
+  insert(3, "/A", [] (Data& data) { data.setFreshnessPeriod(1_h); });
+  advanceClocks(500_ms);
+
+  // both exact match and prefix match return the first match in full name order
+  uint32_t expected = 0;
+  startInterest("/A")
+    .setCanBePrefix(true);
+  find([&] (uint32_t found) { expected = found; });
+  BOOST_CHECK_NE(expected, 0);
+  startInterest("/A");
+  CHECK_CS_FIND(expected);
+
+  startInterest("/A")
+    .setMustBeFresh(true);
+  CHECK_CS_FIND(3);
+
+  // erased entries are no longer found by exact match
+  BOOST_CHECK_EQUAL(erase("/A", 3), 3);
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+  startInterest(n1);
+  CHECK_CS_FIND(0);
+}
+
+BOOST_AUTO_TEST_CASE(ExactName_AfterEviction)
+{
+  cs.setLimit(1);
+  Name n1 = insert(1, "/A");
+  insert(2, "/B");
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+
+  startInterest("/A");
+  CHECK_CS_FIND(0);
+  startInterest(n1);
+  CHECK_CS_FIND(0);
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+}
+
 BOOST_AUTO_TEST_CASE(FullName)
 {
   Name n1 = insert(1, "/A");
@@ -175,6 +218,51 @@ BOOST_AUTO_TEST_CASE(Erase)
   BOOST_CHECK_EQUAL(cs.size(), 2);
 }
 
+BOOST_AUTO_TEST_CASE(DiskTier)
+{
+  cs.setLimit(1);
+  cs.setDiskStore(make_unique<cs::DiskStore>(UNIT_TESTS_TMPDIR "/cs-disk-tier.log", 1 << 20));
+
+  Name n1 = insert(1, "/A/1");
+  insert(2, "/A/2");
+  insert(3, "/B", nullptr, true);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.getDiskStore()->size(), 2); // unsolicited /B is not spilled
+
+  startInterest("/B");
+  CHECK_CS_FIND(3);
+
+  // /A/1 and /A/2 were evicted from memory but are found in the disk tier,
+  // and a packet found in the disk tier is promoted back into memory
+  startInterest("/A/1");
+  CHECK_CS_FIND(1);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  BOOST_CHECK_EQUAL(cs.begin()->getName(), "/A/1");
+  startInterest(n1);
+  CHECK_CS_FIND(1);
+  startInterest("/A/2");
+  CHECK_CS_FIND(2);
+  BOOST_CHECK_EQUAL(cs.begin()->getName(), "/A/2");
+
+  // the promotion of /A/1 evicted /B, which is not spilled
+  startInterest("/B");
+  CHECK_CS_FIND(0);
+
+  cs.enableServe(false);
+  startInterest("/A/1");
+  CHECK_CS_FIND(0);
+  cs.enableServe(true);
+
+  // erase covers both tiers
+  BOOST_CHECK_EQUAL(erase("/", 10), 3);
+  BOOST_CHECK_EQUAL(cs.getDiskStore()->size(), 0);
+  startInterest("/A/1");
+  CHECK_CS_FIND(0);
+
+  cs.setDiskStore(nullptr);
+  BOOST_CHECK(cs.getDiskStore() == nullptr);
+}
+
 // When the capacity limit is set to zero, Data cannot be inserted;
 // this test case covers this situation.
 // The behavior of non-zero capacity limit depends on the eviction policy,
@@ -236,6 +324,63 @@ BOOST_AUTO_TEST_CASE(CachePolicyNoCache)
   CHECK_CS_FIND(0);
 }
 
+BOOST_AUTO_TEST_CASE(PinnedMemory)
+{
+  // returns a Data whose wire encoding is at the beginning of a buffer of the given size
+  auto makeBackedData = [] (const Name& name, size_t bufferSize) {
+    auto data = makeData(name);
+    const Block& wire = data->wireEncode();
+    auto buffer = make_shared<ndn::Buffer>(wire.begin(), wire.end());
+    buffer->resize(bufferSize);
+    return make_shared<Data>(Block(buffer, buffer->begin(), buffer->begin() + wire.size()));
+  };
+  const size_t wireSize = makeData("/A")->wireEncode().size();
+
+  // an entry does not keep alive a buffer much larger than its Data
+  auto dataA = makeBackedData("/A", 8 * wireSize);
+  cs.insert(*dataA);
+  BOOST_REQUIRE_EQUAL(cs.size(), 1);
+  const Data& storedA = cs.begin()->getData();
+  BOOST_CHECK(storedA.wireEncode() == dataA->wireEncode());
+  BOOST_CHECK_EQUAL(storedA.wireEncode().getBuffer()->size(), wireSize);
+  const size_t sizeA = cs.sizeInBytes();
+
+  // a buffer slightly larger than the Data is shared, and charged to the entry in full
+  auto dataB = makeBackedData("/B", wireSize + wireSize / 2);
+  cs.insert(*dataB);
+  BOOST_REQUIRE_EQUAL(cs.size(), 2);
+  const Data& storedB = std::next(cs.begin())->getData();
+  BOOST_CHECK(storedB.wireEncode().getBuffer() == dataB->wireEncode().getBuffer());
+  BOOST_CHECK_EQUAL(cs.sizeInBytes() - sizeA, sizeA + wireSize / 2);
+}
+
+BOOST_AUTO_TEST_CASE(LargerThanByteLimit)
+{
+  insert(1, "/A");
+  insert(2, "/B");
+  const size_t entrySize = cs.sizeInBytes() / 2;
+  cs.setByteLimit(entrySize * 2);
+
+  // a Data that alone exceeds the byte limit is rejected without evicting anything
+  insert(3, "/C", [=] (Data& data) { data.setContent(std::vector<uint8_t>(entrySize * 2)); });
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(cs.sizeInBytes(), entrySize * 2);
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+  startInterest("/B");
+  CHECK_CS_FIND(2);
+  startInterest("/C");
+  CHECK_CS_FIND(0);
+
+  // a Data of exactly the byte limit is admitted, evicting the others
+  cs.setByteLimit(entrySize);
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  insert(4, "/D");
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+  startInterest("/D");
+  CHECK_CS_FIND(4);
+}
+
 BOOST_AUTO_TEST_CASE(Enumeration)
 {
   Name nameA("/A");
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2024,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -52,6 +52,23 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
 }
 
+BOOST_AUTO_TEST_CASE(PrecomputedHashes)
+{
+  Name nameAB("/A/B");
+  Name nameBA("/B/A");
+  const Interest::Nonce nonce1(0x53b4eaa8);
+
+  DeadNonceList dnl;
+  dnl.add(nameAB, name_tree::computeHashes(nameAB), nonce1);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+  BOOST_CHECK_EQUAL(dnl.has(nameAB, nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(nameAB, name_tree::computeHashes(nameAB), nonce1), true);
+
+  // same components in different order must not collide
+  BOOST_CHECK_EQUAL(dnl.has(nameBA, nonce1), false);
+  BOOST_CHECK_EQUAL(dnl.has(nameBA, name_tree::computeHashes(nameBA), nonce1), false);
+}
+
 BOOST_AUTO_TEST_CASE(NoDuplicates)
 {
   Name nameA("ndn:/A");
@@ -100,6 +117,63 @@ BOOST_AUTO_TEST_CASE(MinLifetime)
   BOOST_CHECK_THROW(DeadNonceList(0_ms), std::invalid_argument);
 }
 
+BOOST_AUTO_TEST_CASE(FilterStorage)
+{
+  Name nameA("ndn:/A");
+  Name nameB("ndn:/B");
+  const Interest::Nonce nonce1(0x53b4eaa8);
+  const Interest::Nonce nonce2(0x1f46372b);
+
+  DeadNonceList dnl(DeadNonceList::DEFAULT_LIFETIME, DeadNonceListStorage::FILTER);
+  BOOST_CHECK_EQUAL(dnl.getStorage(), DeadNonceListStorage::FILTER);
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), false);
+
+  dnl.add(nameA, nonce1);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), true);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce2), false);
+  BOOST_CHECK_EQUAL(dnl.has(nameB, nonce1), false);
+
+  // duplicate within the same slice
+  dnl.add(nameA, nonce1);
+  BOOST_CHECK_EQUAL(dnl.size(), 1);
+
+  // changing the storage removes all entries
+  dnl.setStorage(DeadNonceListStorage::EXACT);
+  BOOST_CHECK_EQUAL(dnl.getStorage(), DeadNonceListStorage::EXACT);
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(nameA, nonce1), false);
+  dnl.add(nameB, nonce2);
+  BOOST_CHECK_EQUAL(dnl.has(nameB, nonce2), true);
+
+  dnl.setStorage(DeadNonceListStorage::FILTER);
+  BOOST_CHECK_EQUAL(dnl.size(), 0);
+  BOOST_CHECK_EQUAL(dnl.has(nameB, nonce2), false);
+}
+
+BOOST_AUTO_TEST_CASE(FilterGrowth)
+{
+  Name name("/N");
+  DeadNonceList dnl(DeadNonceList::DEFAULT_LIFETIME, DeadNonceListStorage::FILTER);
+
+  // more than the initial filter of the current slice can hold
+  const uint32_t N_NONCES = DeadNonceList::INITIAL_CAPACITY;
+  for (uint32_t i = 1; i <= N_NONCES; ++i) {
+    dnl.add(name, i);
+  }
+  BOOST_CHECK_GT(dnl.m_slices.back().size(), 1);
+
+  size_t nFound = 0;
+  for (uint32_t i = 1; i <= N_NONCES; ++i) {
+    nFound += dnl.has(name, i);
+  }
+  BOOST_CHECK_EQUAL(nFound, N_NONCES);
+  // false positives may deduplicate a few entries
+  BOOST_CHECK_LE(dnl.size(), N_NONCES);
+  BOOST_CHECK_GT(dnl.size(), N_NONCES * 99 / 100);
+}
+
 /// A fixture that periodically inserts Nonces
 class PeriodicalInsertionFixture : public GlobalIoTimeFixture
 {
@@ -189,6 +263,31 @@ BOOST_FIXTURE_TEST_CASE(CapacityUp, PeriodicalInsertionFixture)
   BOOST_CHECK_LT(std::abs(cap1 - RATE), std::abs(cap0 - RATE));
 }
 
+BOOST_FIXTURE_TEST_CASE(FilterLifetime, PeriodicalInsertionFixture)
+{
+  dnl.setStorage(DeadNonceListStorage::FILTER);
+
+  const int RATE = DeadNonceList::INITIAL_CAPACITY * 3;
+  this->setRate(RATE);
+  this->advanceClocksByLifetime(10.0);
+  BOOST_CHECK_EQUAL(dnl.m_slices.size(), DeadNonceList::EXPECTED_MARK_COUNT + 1);
+
+  Name nameC("ndn:/C");
+  const Interest::Nonce nonceC(0x25390656);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+  dnl.add(nameC, nonceC);
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(0.5); // -50%, entry should exist
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), true);
+
+  this->advanceClocksByLifetime(1.0); // +50%, entry should be gone
+  BOOST_CHECK_EQUAL(dnl.has(nameC, nonceC), false);
+
+  // the filters are sized according to the insertion rate
+  BOOST_CHECK_GE(dnl.m_slices.front().front().getCapacity(), RATE / DeadNonceList::EXPECTED_MARK_COUNT);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestDeadNonceList
 BOOST_AUTO_TEST_SUITE_END() // Table
 
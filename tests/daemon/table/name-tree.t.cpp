@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2023,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -31,11 +31,18 @@
 #include <unordered_set>
 
 #include <boost/range/concepts.hpp>
+#include <boost/test/data/test_case.hpp>
 #include <ndn-cxx/util/concepts.hpp>
 
 namespace nfd::tests {
 
 using namespace nfd::name_tree;
+namespace bdata = boost::unit_test::data;
+
+const std::vector<HashtableLayout> layouts{
+  HashtableLayout::CHAINED,
+  HashtableLayout::OPEN_ADDRESSING,
+};
 
 NDN_CXX_ASSERT_FORWARD_ITERATOR(NameTree::const_iterator);
 BOOST_CONCEPT_ASSERT((boost::ForwardRangeConcept<Range>));
@@ -59,13 +66,49 @@ BOOST_AUTO_TEST_CASE(ComputeHash)
   BOOST_CHECK_EQUAL(hashes.size(), 3);
 }
 
+BOOST_AUTO_TEST_CASE(CachedHashes)
+{
+  auto interest = makeInterest("/A/B/C");
+  BOOST_CHECK(interest->getTag<HashSequenceTag>() == nullptr);
+
+  const HashSequence& hashes = getHashes(*interest);
+  BOOST_CHECK(hashes == computeHashes(interest->getName()));
+  auto tag = interest->getTag<HashSequenceTag>();
+  BOOST_REQUIRE(tag != nullptr);
+  BOOST_CHECK_EQUAL(&tag->get().hashes, &hashes);
+
+  // second call returns the cached sequence
+  BOOST_CHECK_EQUAL(&getHashes(*interest), &hashes);
+
+  // a stale tag is replaced
+  interest->setName("/A/B/C/D");
+  BOOST_CHECK(getHashes(*interest) == computeHashes("/A/B/C/D"));
+
+  // including after a rename to another name with the same number of components
+  interest->setName("/W/X/Y/Z");
+  BOOST_CHECK(getHashes(*interest) == computeHashes("/W/X/Y/Z"));
+
+  // a copy of the packet shares the tag with the original until it is renamed
+  Interest copy(*interest);
+  BOOST_CHECK(getHashes(copy) == computeHashes("/W/X/Y/Z"));
+  copy.setName("/P/Q/R/S");
+  BOOST_CHECK(getHashes(copy) == computeHashes("/P/Q/R/S"));
+  BOOST_CHECK(getHashes(*interest) == computeHashes("/W/X/Y/Z"));
+
+  auto data = makeData("/D/E");
+  BOOST_CHECK(getHashes(*data) == computeHashes(data->getName()));
+  BOOST_CHECK(data->getTag<HashSequenceTag>() != nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE(Hashtable)
 
 using name_tree::Hashtable;
 
-BOOST_AUTO_TEST_CASE(Modifiers)
+BOOST_DATA_TEST_CASE(Modifiers, bdata::make(layouts), layout)
 {
-  Hashtable ht(HashtableOptions(16));
+  HashtableOptions options(16);
+  options.layout = layout;
+  Hashtable ht(options);
 
   Name name("/A/B/C/D");
   HashSequence hashes = computeHashes(name);
@@ -110,9 +153,10 @@ BOOST_AUTO_TEST_CASE(Modifiers)
   BOOST_CHECK(ht.find(name, 4) == nullptr);
 }
 
-BOOST_AUTO_TEST_CASE(Resize)
+BOOST_DATA_TEST_CASE(Resize, bdata::make(layouts), layout)
 {
   HashtableOptions options(9);
+  options.layout = layout;
   BOOST_CHECK_EQUAL(options.initialSize, 9);
   BOOST_CHECK_EQUAL(options.minSize, 9);
   options.minSize = 6;
@@ -190,6 +234,60 @@ BOOST_AUTO_TEST_CASE(Resize)
   BOOST_CHECK_EQUAL(ht.getNBuckets(), 6);
 }
 
+BOOST_AUTO_TEST_CASE(OpenAddressingCollisions)
+{
+  HashtableOptions options(8);
+  options.layout = HashtableLayout::OPEN_ADDRESSING;
+  options.expandLoadFactor = 1.0; // allow the table to become (almost) full
+  options.shrinkLoadFactor = 0.0;
+  Hashtable ht(options);
+
+  // insert nodes whose hash values all map to the same home slot
+  std::vector<Name> names;
+  std::vector<const Node*> nodes;
+  for (int i = 0; nodes.size() < 7; ++i) {
+    Name name = Name("/A").appendNumber(i);
+    HashSequence hashes = computeHashes(name);
+    if (ht.computeBucketIndex(hashes.back()) != 5) {
+      continue;
+    }
+    const Node* node = nullptr;
+    bool isNew = false;
+    std::tie(node, isNew) = ht.insert(name, name.size(), hashes);
+    BOOST_CHECK(isNew);
+    names.push_back(name);
+    nodes.push_back(node);
+  }
+  BOOST_CHECK_EQUAL(ht.size(), 7);
+  BOOST_CHECK_EQUAL(ht.getNBuckets(), 8);
+
+  // probing wraps around the end of the slot array
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    BOOST_CHECK_EQUAL(ht.findBucketIndex(nodes[i]), (5 + i) % 8);
+    BOOST_CHECK_EQUAL(ht.getBucket((5 + i) % 8), nodes[i]);
+  }
+
+  // erasing from the middle of the run shifts the remaining nodes backward
+  ht.erase(const_cast<Node*>(nodes[2]));
+  BOOST_CHECK_EQUAL(ht.size(), 6);
+  for (size_t i = 3; i < nodes.size(); ++i) {
+    BOOST_CHECK_EQUAL(ht.findBucketIndex(nodes[i]), (4 + i) % 8);
+  }
+  BOOST_CHECK(ht.getBucket(3) == nullptr);
+
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    BOOST_CHECK_EQUAL(ht.find(names[i], names[i].size()), i == 2 ? nullptr : nodes[i]);
+  }
+
+  // inserting one more node beyond the threshold expands the table
+  Name nameB("/B");
+  ht.insert(nameB, nameB.size(), computeHashes(nameB));
+  BOOST_CHECK_EQUAL(ht.getNBuckets(), 8);
+  ht.insert(names[2], names[2].size(), computeHashes(names[2]));
+  BOOST_CHECK_EQUAL(ht.size(), 8);
+  BOOST_CHECK_EQUAL(ht.getNBuckets(), 16);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Hashtable
 
 BOOST_AUTO_TEST_SUITE(TestEntry)
@@ -300,10 +398,79 @@ BOOST_AUTO_TEST_CASE(TableEntries)
 
 BOOST_AUTO_TEST_SUITE_END() // TestEntry
 
-BOOST_AUTO_TEST_CASE(Basic)
+BOOST_DATA_TEST_CASE(PrecomputedHashes, bdata::make(layouts), layout)
+{
+  HashtableOptions options;
+  options.layout = layout;
+  NameTree nt(options);
+  Name nameABC("/A/B/C");
+  HashSequence hashes = computeHashes(nameABC);
+
+  Entry& entryAB = nt.lookup(nameABC, 2, hashes);
+  BOOST_CHECK_EQUAL(entryAB.getName(), "/A/B");
+  BOOST_CHECK_EQUAL(&nt.lookup("/A/B"), &entryAB);
+  BOOST_CHECK_EQUAL(nt.size(), 3);
+
+  BOOST_CHECK_EQUAL(nt.findExactMatch(nameABC, 2, hashes), &entryAB);
+  BOOST_CHECK(nt.findExactMatch(nameABC, 3, hashes) == nullptr);
+
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(nameABC, hashes), &entryAB);
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatch(nameABC, hashes,
+                                              [] (const Entry& entry) { return entry.getName().size() < 2; }),
+                    nt.findExactMatch("/A"));
+
+  auto&& allMatches = nt.findAllMatches(nameABC, hashes);
+  BOOST_CHECK_EQUAL(std::distance(allMatches.begin(), allMatches.end()), 3);
+}
+
+BOOST_DATA_TEST_CASE(Batch, bdata::make(layouts), layout)
+{
+  HashtableOptions options(16);
+  options.layout = layout;
+  NameTree nt(options);
+
+  // the batch causes the hashtable to expand
+  std::vector<Name> names;
+  for (int i = 0; i < 20; ++i) {
+    names.push_back(Name("/A").appendNumber(i).append("C"));
+  }
+  names.push_back(names.front()); // duplicate
+  names.push_back(Name("/D").append(Name("/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x/x")));
+
+  auto entries = nt.lookupBatch(names);
+  BOOST_REQUIRE_EQUAL(entries.size(), names.size());
+  for (size_t i = 0; i + 1 < names.size(); ++i) {
+    BOOST_CHECK_EQUAL(entries[i]->getName(), names[i]);
+    BOOST_CHECK_EQUAL(entries[i], nt.findExactMatch(names[i]));
+  }
+  BOOST_CHECK_EQUAL(entries[20], entries[0]);
+  // long names are truncated to the maximum depth
+  BOOST_CHECK_EQUAL(entries.back()->getName(), names.back().getPrefix(NameTree::getMaxDepth()));
+  BOOST_CHECK_EQUAL(nt.size(), 1 + 1 + 20 * 2 + NameTree::getMaxDepth());
+
+  const Name queries[] = {"/A/%00/C/D", "/A/%01", "/B", "/", "/D/x/x"};
+  auto matches = nt.findLongestPrefixMatchBatch(queries);
+  BOOST_REQUIRE_EQUAL(matches.size(), std::size(queries));
+  for (size_t i = 0; i < std::size(queries); ++i) {
+    BOOST_CHECK_EQUAL(matches[i], nt.findLongestPrefixMatch(queries[i]));
+  }
+  BOOST_CHECK_EQUAL(matches[0]->getName(), "/A/%00/C");
+
+  auto selected = nt.findLongestPrefixMatchBatch(queries,
+                    [] (const Entry& entry) { return entry.getName().size() < 2; });
+  BOOST_CHECK_EQUAL(selected[0]->getName(), "/A");
+  BOOST_CHECK_EQUAL(selected[3]->getName(), "/");
+
+  BOOST_CHECK_EQUAL(nt.lookupBatch({}).size(), 0);
+  BOOST_CHECK_EQUAL(nt.findLongestPrefixMatchBatch({}).size(), 0);
+}
+
+BOOST_DATA_TEST_CASE(Basic, bdata::make(layouts), layout)
 {
   size_t nBuckets = 16;
-  NameTree nt(nBuckets);
+  HashtableOptions options(nBuckets);
+  options.layout = layout;
+  NameTree nt(options);
 
   BOOST_CHECK_EQUAL(nt.size(), 0);
   BOOST_CHECK_EQUAL(nt.getNBuckets(), nBuckets);
@@ -469,56 +636,62 @@ private:
 class EnumerationFixture : public GlobalIoFixture
 {
 protected:
-  EnumerationFixture()
-    : nt(N_BUCKETS)
+  /** \brief Replace the NameTree with an empty one that uses \p layout.
+   */
+  void
+  useLayout(HashtableLayout layout)
   {
-    BOOST_CHECK_EQUAL(nt.size(), 0);
-    BOOST_CHECK_EQUAL(nt.getNBuckets(), N_BUCKETS);
+    HashtableOptions options(N_BUCKETS);
+    options.layout = layout;
+    nt = make_unique<NameTree>(options);
+    BOOST_CHECK_EQUAL(nt->size(), 0);
+    BOOST_CHECK_EQUAL(nt->getNBuckets(), N_BUCKETS);
   }
 
   void
   insertAbAc()
   {
-    nt.lookup("/a/b");
-    nt.lookup("/a/c");
-    BOOST_CHECK_EQUAL(nt.size(), 4);
+    nt->lookup("/a/b");
+    nt->lookup("/a/c");
+    BOOST_CHECK_EQUAL(nt->size(), 4);
     // /, /a, /a/b, /a/c
   }
 
   void
   insertAb1Ab2Ac1Ac2()
   {
-    nt.lookup("/a/b/1");
-    nt.lookup("/a/b/2");
-    nt.lookup("/a/c/1");
-    nt.lookup("/a/c/2");
-    BOOST_CHECK_EQUAL(nt.size(), 8);
+    nt->lookup("/a/b/1");
+    nt->lookup("/a/b/2");
+    nt->lookup("/a/c/1");
+    nt->lookup("/a/c/2");
+    BOOST_CHECK_EQUAL(nt->size(), 8);
     // /, /a, /a/b, /a/b/1, /a/b/2, /a/c, /a/c/1, /a/c/2
   }
 
 protected:
   static constexpr size_t N_BUCKETS = 16;
-  NameTree nt;
+  unique_ptr<NameTree> nt;
 };
 
-BOOST_FIXTURE_TEST_CASE(IteratorFullEnumerate, EnumerationFixture)
+BOOST_DATA_TEST_CASE_F(EnumerationFixture, IteratorFullEnumerate, bdata::make(layouts), layout)
 {
-  nt.lookup("/a/b/c");
-  BOOST_CHECK_EQUAL(nt.size(), 4);
+  useLayout(layout);
+  nt->lookup("/a/b/c");
+  BOOST_CHECK_EQUAL(nt->size(), 4);
 
-  nt.lookup("/a/b/d");
-  BOOST_CHECK_EQUAL(nt.size(), 5);
+  nt->lookup("/a/b/d");
+  BOOST_CHECK_EQUAL(nt->size(), 5);
 
-  nt.lookup("/a/e");
-  BOOST_CHECK_EQUAL(nt.size(), 6);
+  nt->lookup("/a/e");
+  BOOST_CHECK_EQUAL(nt->size(), 6);
 
-  nt.lookup("/f");
-  BOOST_CHECK_EQUAL(nt.size(), 7);
+  nt->lookup("/f");
+  BOOST_CHECK_EQUAL(nt->size(), 7);
 
-  nt.lookup("/");
-  BOOST_CHECK_EQUAL(nt.size(), 7);
+  nt->lookup("/");
+  BOOST_CHECK_EQUAL(nt->size(), 7);
 
-  auto&& enumerable = nt.fullEnumerate();
+  auto&& enumerable = nt->fullEnumerate();
   EnumerationVerifier(enumerable)
     .expect("/")
     .expect("/a")
@@ -532,32 +705,35 @@ BOOST_FIXTURE_TEST_CASE(IteratorFullEnumerate, EnumerationFixture)
 
 BOOST_FIXTURE_TEST_SUITE(IteratorPartialEnumerate, EnumerationFixture)
 
-BOOST_AUTO_TEST_CASE(Empty)
+BOOST_DATA_TEST_CASE(Empty, bdata::make(layouts), layout)
 {
-  auto&& enumerable = nt.partialEnumerate("/a");
+  useLayout(layout);
+  auto&& enumerable = nt->partialEnumerate("/a");
 
   EnumerationVerifier(enumerable)
     .end();
 }
 
-BOOST_AUTO_TEST_CASE(NotIn)
+BOOST_DATA_TEST_CASE(NotIn, bdata::make(layouts), layout)
 {
+  useLayout(layout);
   this->insertAbAc();
 
   // Enumerate on some name that is not in nameTree
   Name name0("/0");
-  auto&& enumerable = nt.partialEnumerate("/0");
+  auto&& enumerable = nt->partialEnumerate("/0");
 
   EnumerationVerifier(enumerable)
     .end();
 }
 
-BOOST_AUTO_TEST_CASE(OnlyA)
+BOOST_DATA_TEST_CASE(OnlyA, bdata::make(layouts), layout)
 {
+  useLayout(layout);
   this->insertAbAc();
 
   // Accept "root" nameA only
-  auto&& enumerable = nt.partialEnumerate("/a", [] (const Entry& entry) {
+  auto&& enumerable = nt->partialEnumerate("/a", [] (const Entry& entry) {
     return std::pair(entry.getName() == "/a", true);
   });
 
@@ -566,12 +742,13 @@ BOOST_AUTO_TEST_CASE(OnlyA)
     .end();
 }
 
-BOOST_AUTO_TEST_CASE(ExceptA)
+BOOST_DATA_TEST_CASE(ExceptA, bdata::make(layouts), layout)
 {
+  useLayout(layout);
   this->insertAbAc();
 
   // Accept anything except "root" nameA
-  auto&& enumerable = nt.partialEnumerate("/a", [] (const Entry& entry) {
+  auto&& enumerable = nt->partialEnumerate("/a", [] (const Entry& entry) {
     return std::pair(entry.getName() != "/a", true);
   });
 
@@ -581,13 +758,14 @@ BOOST_AUTO_TEST_CASE(ExceptA)
     .end();
 }
 
-BOOST_AUTO_TEST_CASE(NoNameANoSubTreeAB)
+BOOST_DATA_TEST_CASE(NoNameANoSubTreeAB, bdata::make(layouts), layout)
 {
+  useLayout(layout);
   this->insertAb1Ab2Ac1Ac2();
 
   // No NameA
   // No SubTree from NameAB
-  auto&& enumerable = nt.partialEnumerate("/a", [] (const Entry& entry) {
+  auto&& enumerable = nt->partialEnumerate("/a", [] (const Entry& entry) {
       return std::pair(entry.getName() != "/a", entry.getName() != "/a/b");
     });
 
@@ -599,13 +777,14 @@ BOOST_AUTO_TEST_CASE(NoNameANoSubTreeAB)
     .end();
 }
 
-BOOST_AUTO_TEST_CASE(NoNameANoSubTreeAC)
+BOOST_DATA_TEST_CASE(NoNameANoSubTreeAC, bdata::make(layouts), layout)
 {
+  useLayout(layout);
   this->insertAb1Ab2Ac1Ac2();
 
   // No NameA
   // No SubTree from NameAC
-  auto&& enumerable = nt.partialEnumerate("/a", [] (const Entry& entry) {
+  auto&& enumerable = nt->partialEnumerate("/a", [] (const Entry& entry) {
       return std::pair(entry.getName() != "/a", entry.getName() != "/a/c");
     });
 
@@ -617,12 +796,13 @@ BOOST_AUTO_TEST_CASE(NoNameANoSubTreeAC)
     .end();
 }
 
-BOOST_AUTO_TEST_CASE(NoSubTreeA)
+BOOST_DATA_TEST_CASE(NoSubTreeA, bdata::make(layouts), layout)
 {
+  useLayout(layout);
   this->insertAb1Ab2Ac1Ac2();
 
   // No Subtree from NameA
-  auto&& enumerable = nt.partialEnumerate("/a", [] (const Entry& entry) {
+  auto&& enumerable = nt->partialEnumerate("/a", [] (const Entry& entry) {
       return std::pair(true, entry.getName() != "/a");
     });
 
@@ -631,8 +811,9 @@ BOOST_AUTO_TEST_CASE(NoSubTreeA)
     .end();
 }
 
-BOOST_AUTO_TEST_CASE(Example)
+BOOST_DATA_TEST_CASE(Example, bdata::make(layouts), layout)
 {
+  useLayout(layout);
   // Example
   // /
   // /A
@@ -642,14 +823,14 @@ BOOST_AUTO_TEST_CASE(Example)
   // /E
   // /F
 
-  nt.lookup("/A");
-  nt.lookup("/A/B");
-  nt.lookup("/A/B/C");
-  nt.lookup("/A/D");
-  nt.lookup("/E");
-  nt.lookup("/F");
+  nt->lookup("/A");
+  nt->lookup("/A/B");
+  nt->lookup("/A/B/C");
+  nt->lookup("/A/D");
+  nt->lookup("/E");
+  nt->lookup("/F");
 
-  auto&& enumerable = nt.partialEnumerate("/A", [] (const Entry& entry) {
+  auto&& enumerable = nt->partialEnumerate("/A", [] (const Entry& entry) {
     bool visitEntry = false;
     bool visitChildren = false;
 
@@ -672,15 +853,16 @@ BOOST_AUTO_TEST_CASE(Example)
 
 BOOST_AUTO_TEST_SUITE_END() // IteratorPartialEnumerate
 
-BOOST_FIXTURE_TEST_CASE(IteratorFindAllMatches, EnumerationFixture)
+BOOST_DATA_TEST_CASE_F(EnumerationFixture, IteratorFindAllMatches, bdata::make(layouts), layout)
 {
-  nt.lookup("/a/b/c/d/e/f");
-  nt.lookup("/a/a/c");
-  nt.lookup("/a/a/d/1");
-  nt.lookup("/a/a/d/2");
-  BOOST_CHECK_EQUAL(nt.size(), 12);
+  useLayout(layout);
+  nt->lookup("/a/b/c/d/e/f");
+  nt->lookup("/a/a/c");
+  nt->lookup("/a/a/d/1");
+  nt->lookup("/a/a/d/2");
+  BOOST_CHECK_EQUAL(nt->size(), 12);
 
-  auto&& allMatches = nt.findAllMatches("/a/b/c/d/e");
+  auto&& allMatches = nt->findAllMatches("/a/b/c/d/e");
 
   EnumerationVerifier(allMatches)
     .expect("/")
@@ -692,10 +874,12 @@ BOOST_FIXTURE_TEST_CASE(IteratorFindAllMatches, EnumerationFixture)
     .end();
 }
 
-BOOST_AUTO_TEST_CASE(HashTableResizeShrink)
+BOOST_DATA_TEST_CASE(HashTableResizeShrink, bdata::make(layouts), layout)
 {
   size_t nBuckets = 16;
-  NameTree nameTree(nBuckets);
+  HashtableOptions options(nBuckets);
+  options.layout = layout;
+  NameTree nameTree(options);
 
   Name prefix("/a/b/c/d/e/f/g/h"); // requires 9 buckets
 
@@ -708,10 +892,39 @@ BOOST_AUTO_TEST_CASE(HashTableResizeShrink)
   BOOST_CHECK_EQUAL(nameTree.getNBuckets(), 16);
 }
 
+BOOST_DATA_TEST_CASE(Layouts, bdata::make(layouts), layout)
+{
+  HashtableOptions options(4);
+  options.layout = layout;
+  NameTree nt(options);
+
+  for (int i = 0; i < 50; ++i) {
+    nt.lookup(Name("/A").appendNumber(i).append("B"));
+  }
+  BOOST_CHECK_EQUAL(nt.size(), 102);
+  BOOST_CHECK_GT(nt.getNBuckets(), 102);
+
+  std::set<Name> seenNames;
+  for (const Entry& entry : nt) {
+    BOOST_CHECK(seenNames.insert(entry.getName()).second);
+    BOOST_CHECK_EQUAL(nt.findExactMatch(entry.getName()), &entry);
+  }
+  BOOST_CHECK_EQUAL(seenNames.size(), 102);
+
+  for (int i = 0; i < 50; ++i) {
+    Entry* entry = nt.findExactMatch(Name("/A").appendNumber(i).append("B"));
+    BOOST_REQUIRE(entry != nullptr);
+    nt.eraseIfEmpty(entry);
+  }
+  BOOST_CHECK_EQUAL(nt.size(), 0);
+}
+
 // .lookup should not invalidate iterator
-BOOST_AUTO_TEST_CASE(SurvivedIteratorAfterLookup)
+BOOST_DATA_TEST_CASE(SurvivedIteratorAfterLookup, bdata::make(layouts), layout)
 {
-  NameTree nt;
+  HashtableOptions options(1024); // large enough that the hashtable is not resized while iterating
+  options.layout = layout;
+  NameTree nt(options);
   nt.lookup("/A/B/C");
   nt.lookup("/E");
 
@@ -735,9 +948,11 @@ BOOST_AUTO_TEST_CASE(SurvivedIteratorAfterLookup)
 }
 
 // .eraseIfEmpty should not invalidate iterator
-BOOST_AUTO_TEST_CASE(SurvivedIteratorAfterErase)
+BOOST_DATA_TEST_CASE(SurvivedIteratorAfterErase, bdata::make(layouts), layout)
 {
-  NameTree nt;
+  HashtableOptions options(1024); // large enough that the hashtable is not resized while iterating
+  options.layout = layout;
+  NameTree nt(options);
   nt.lookup("/A/B/C");
   nt.lookup("/A/D/E");
   nt.lookup("/A/F/G");
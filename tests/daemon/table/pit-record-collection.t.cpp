@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/pit-record-collection.hpp"
+#include "common/memory-pool.hpp"
+
+#include "tests/test-common.hpp"
+
+#include <set>
+
+namespace nfd::tests {
+
+using pit::RecordCollection;
+
+namespace {
+
+class Record : noncopyable
+{
+public:
+  Record(int value, int& nAlive)
+    : value(value)
+    , m_nAlive(nAlive)
+  {
+    ++m_nAlive;
+  }
+
+  ~Record()
+  {
+    --m_nAlive;
+  }
+
+public:
+  int value;
+
+private:
+  int& m_nAlive;
+};
+
+template<typename Collection>
+std::multiset<int>
+collectValues(const Collection& coll)
+{
+  std::multiset<int> values;
+  for (const auto& record : coll) {
+    values.insert(record.value);
+  }
+  return values;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_AUTO_TEST_SUITE(TestPitRecordCollection)
+
+BOOST_AUTO_TEST_CASE(Inline)
+{
+  int nAlive = 0;
+  auto pool = make_shared<MemoryPool>();
+  {
+    RecordCollection<Record, 2, PoolAllocator<Record>> coll{PoolAllocator<Record>(pool)};
+    BOOST_CHECK(coll.empty());
+    BOOST_CHECK(coll.begin() == coll.end());
+
+    auto it1 = coll.emplace(1, nAlive);
+    auto it2 = coll.emplace(2, nAlive);
+    BOOST_CHECK_EQUAL(coll.size(), 2);
+    BOOST_CHECK_EQUAL(nAlive, 2);
+    BOOST_CHECK_EQUAL(it1->value, 1);
+    BOOST_CHECK_EQUAL(it2->value, 2);
+    BOOST_CHECK_EQUAL(std::distance(coll.begin(), coll.end()), 2);
+    // inline records do not allocate
+    BOOST_CHECK_EQUAL(pool->getNAllocated(), 0);
+
+    // erased inline slot is reused
+    const Record* addr1 = &*it1;
+    coll.erase(it1);
+    BOOST_CHECK_EQUAL(coll.size(), 1);
+    BOOST_CHECK_EQUAL(nAlive, 1);
+    BOOST_CHECK_EQUAL(coll.front().value, 2);
+    auto it3 = coll.emplace(3, nAlive);
+    BOOST_CHECK_EQUAL(&*it3, addr1);
+    BOOST_CHECK(collectValues(coll) == (std::multiset<int>{2, 3}));
+    BOOST_CHECK_EQUAL(pool->getNAllocated(), 0);
+  }
+  BOOST_CHECK_EQUAL(nAlive, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Spill)
+{
+  int nAlive = 0;
+  auto pool = make_shared<MemoryPool>();
+  {
+    RecordCollection<Record, 2, PoolAllocator<Record>> coll{PoolAllocator<Record>(pool)};
+    std::vector<RecordCollection<Record, 2, PoolAllocator<Record>>::iterator> its;
+    for (int i = 0; i < 6; ++i) {
+      its.push_back(coll.emplace(i, nAlive));
+    }
+    BOOST_CHECK_EQUAL(coll.size(), 6);
+    BOOST_CHECK_EQUAL(nAlive, 6);
+    BOOST_CHECK_GT(pool->getNAllocated(), 0);
+    BOOST_CHECK(collectValues(coll) == (std::multiset<int>{0, 1, 2, 3, 4, 5}));
+
+    // erasing records does not invalidate iterators to other records
+    coll.erase(its[0]);
+    coll.erase(its[3]);
+    BOOST_CHECK_EQUAL(coll.size(), 4);
+    BOOST_CHECK_EQUAL(nAlive, 4);
+    for (int i : {1, 2, 4, 5}) {
+      BOOST_CHECK_EQUAL(its[i]->value, i);
+    }
+    BOOST_CHECK(collectValues(coll) == (std::multiset<int>{1, 2, 4, 5}));
+
+    // inserting records does not invalidate iterators either
+    for (int i = 6; i < 10; ++i) {
+      coll.emplace(i, nAlive);
+    }
+    for (int i : {1, 2, 4, 5}) {
+      BOOST_CHECK_EQUAL(its[i]->value, i);
+    }
+    BOOST_CHECK_EQUAL(std::distance(coll.begin(), coll.end()), 8);
+
+    coll.clear();
+    BOOST_CHECK(coll.empty());
+    BOOST_CHECK(coll.begin() == coll.end());
+    BOOST_CHECK_EQUAL(nAlive, 0);
+    BOOST_CHECK_EQUAL(pool->getNAllocated(), 0);
+
+    coll.emplace(10, nAlive);
+    coll.emplace(11, nAlive);
+    coll.emplace(12, nAlive);
+  }
+  BOOST_CHECK_EQUAL(nAlive, 0);
+  BOOST_CHECK_EQUAL(pool->getNAllocated(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ConstIterator)
+{
+  int nAlive = 0;
+  RecordCollection<Record, 1> coll;
+  auto it = coll.emplace(1, nAlive);
+  coll.emplace(2, nAlive);
+
+  const auto& constColl = coll;
+  RecordCollection<Record, 1>::const_iterator cit = it;
+  BOOST_CHECK(cit == constColl.begin());
+  BOOST_CHECK(it == constColl.begin());
+
+  auto lastIt = std::max_element(constColl.begin(), constColl.end(),
+                                 [] (const Record& a, const Record& b) { return a.value < b.value; });
+  BOOST_REQUIRE(lastIt != constColl.end());
+  BOOST_CHECK_EQUAL(lastIt->value, 2);
+
+  coll.erase(cit);
+  BOOST_CHECK_EQUAL(constColl.front().value, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPitRecordCollection
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace nfd::tests
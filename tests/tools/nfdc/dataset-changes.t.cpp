@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "nfdc/dataset-changes.hpp"
+
+#include "execute-command-fixture.hpp"
+
+namespace nfd::tools::nfdc::tests {
+
+BOOST_AUTO_TEST_SUITE(Nfdc)
+BOOST_FIXTURE_TEST_SUITE(TestDatasetChanges, ExecuteCommandFixture)
+
+const std::string FIB_CHANGES_OUTPUT = std::string(R"TEXT(
+epoch=3 version=12 full-snapshot=no
+  /A nexthops={faceid=262 (cost=9)}
+)TEXT").substr(1);
+
+BOOST_AUTO_TEST_CASE(FibChanges)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    BOOST_CHECK_EQUAL(interest.getName(),
+                      Name("/localhost/nfd/fib/changes").appendNumber(3).appendNumber(7));
+
+    ndn::nfd::FibEntry entry;
+    entry.setPrefix("/A")
+         .addNextHopRecord(ndn::nfd::NextHopRecord().setFaceId(262).setCost(9));
+    this->sendDataset(interest.getName(), DatasetDeltaHeader{3, 12, false}, entry);
+  };
+
+  this->execute("fib changes epoch 3 since 7");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal(FIB_CHANGES_OUTPUT));
+  BOOST_CHECK(err.is_empty());
+}
+
+const std::string ROUTE_CHANGES_OUTPUT = std::string(R"TEXT(
+epoch=3 version=13 full-snapshot=no
+removed prefix=/B
+)TEXT").substr(1);
+
+BOOST_AUTO_TEST_CASE(RouteChanges)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    BOOST_CHECK_EQUAL(interest.getName(),
+                      Name("/localhost/nfd/rib/changes").appendNumber(3).appendNumber(12));
+    this->sendDataset(interest.getName(), DatasetDeltaHeader{3, 13, false}, DatasetRemoval{Name("/B")});
+  };
+
+  this->execute("route changes 3 12");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal(ROUTE_CHANGES_OUTPUT));
+  BOOST_CHECK(err.is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(FaceChangesFullSnapshot)
+{
+  this->processInterest = [this] (const Interest& interest) {
+    BOOST_CHECK_EQUAL(interest.getName(), "/localhost/nfd/faces/changes");
+    this->sendDataset(interest.getName(), DatasetDeltaHeader{3, 5, true});
+  };
+
+  this->execute("face changes");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal("epoch=3 version=5 full-snapshot=yes\n"));
+  BOOST_CHECK(err.is_empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDatasetChanges
+BOOST_AUTO_TEST_SUITE_END() // Nfdc
+
+} // namespace nfd::tools::nfdc::tests
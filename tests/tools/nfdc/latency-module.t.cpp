@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "nfdc/latency-module.hpp"
+
+#include "status-fixture.hpp"
+
+namespace nfd::tools::nfdc::tests {
+
+BOOST_AUTO_TEST_SUITE(Nfdc)
+BOOST_FIXTURE_TEST_SUITE(TestLatencyModule, StatusFixture<LatencyModule>)
+
+const std::string STATUS_XML = stripXmlSpaces(R"XML(
+  <latency>
+    <latencyHistogram>
+      <label>pit-insert</label>
+      <count>2</count>
+      <mean>PT0.000000200S</mean>
+      <p50>PT0.000000127S</p50>
+      <p99>PT0.000000300S</p99>
+      <max>PT0.000000300S</max>
+    </latencyHistogram>
+    <latencyHistogram>
+      <label>face-tx</label>
+      <faceId>300</faceId>
+      <count>0</count>
+    </latencyHistogram>
+  </latency>
+)XML");
+
+const std::string STATUS_TEXT = std::string(R"TEXT(
+Latency:
+  pit-insert count=2 mean=200ns p50=127ns p99=300ns max=300ns
+  face-tx faceid=300 count=0
+)TEXT").substr(1);
+
+BOOST_AUTO_TEST_CASE(Status)
+{
+  this->fetchStatus();
+  LatencyStatus payload1;
+  payload1.label = "pit-insert";
+  payload1.histogram.record(100_ns);
+  payload1.histogram.record(300_ns);
+  LatencyStatus payload2;
+  payload2.label = "face-tx";
+  payload2.faceId = 300;
+  this->sendDataset("/localhost/nfd/status/latency", payload1, payload2);
+  this->prepareStatusOutput();
+
+  BOOST_CHECK(statusXml.is_equal(STATUS_XML));
+  BOOST_CHECK(statusText.is_equal(STATUS_TEXT));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestLatencyModule
+BOOST_AUTO_TEST_SUITE_END() // Nfdc
+
+} // namespace nfd::tools::nfdc::tests
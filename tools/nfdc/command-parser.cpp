@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -26,6 +26,7 @@
 #include "command-parser.hpp"
 
 #include "cs-module.hpp"
+#include "dataset-changes.hpp"
 #include "face-module.hpp"
 #include "rib-module.hpp"
 #include "status.hpp"
@@ -140,6 +141,7 @@ registerCommands(CommandParser& parser)
   RibModule::registerCommands(parser);
   CsModule::registerCommands(parser);
   StrategyChoiceModule::registerCommands(parser);
+  registerChangesCommands(parser);
 }
 
 } // namespace nfd::tools::nfdc
@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "dataset-changes.hpp"
+#include "face-module.hpp"
+#include "fib-module.hpp"
+#include "format-helpers.hpp"
+#include "rib-module.hpp"
+
+namespace nfd::tools::nfdc {
+
+/** \brief Prints the changes of a dataset since the epoch and version given in the 'epoch'
+ *         and 'since' arguments, or a full snapshot if they are omitted.
+ */
+template<typename Dataset, typename FormatItem>
+static void
+showChanges(ExecuteContext& ctx, const std::string& datasetName, const FormatItem& formatItem)
+{
+  auto epoch = ctx.args.getOptional<uint64_t>("epoch");
+  auto version = ctx.args.getOptional<uint64_t>("since");
+  std::optional<DatasetPosition> since;
+  if (epoch || version) {
+    since = DatasetPosition{epoch.value_or(0), version.value_or(0)};
+  }
+
+  ctx.controller.fetch<Dataset>(
+    since,
+    [&] (const typename Dataset::ResultType& result) {
+      text::ItemAttributes ia;
+      ctx.out << ia("epoch") << result.header.epoch
+              << ia("version") << result.header.version
+              << ia("full-snapshot") << text::YesNo{result.header.isFullSnapshot}
+              << ia.end() << '\n';
+
+      for (const auto& item : result.items) {
+        formatItem(ctx.out, item);
+      }
+
+      for (const auto& removal : result.removals) {
+        ctx.out << "removed ";
+        if (const auto* name = std::get_if<Name>(&removal.key)) {
+          ctx.out << "prefix=" << *name;
+        }
+        else {
+          ctx.out << "faceid=" << std::get<uint64_t>(removal.key);
+        }
+        ctx.out << '\n';
+      }
+    },
+    ctx.makeDatasetFailureHandler(datasetName),
+    ctx.makeCommandOptions());
+
+  ctx.face.processEvents();
+}
+
+/** \brief The 'fib changes' command.
+ */
+static void
+showFibChanges(ExecuteContext& ctx)
+{
+  FibModule module;
+  showChanges<FibChangesDataset>(ctx, "FIB changes dataset",
+    [&] (std::ostream& os, const ndn::nfd::FibEntry& item) {
+      module.formatItemText(os, item);
+    });
+}
+
+/** \brief The 'route changes' command.
+ */
+static void
+showRibChanges(ExecuteContext& ctx)
+{
+  showChanges<RibChangesDataset>(ctx, "RIB changes dataset",
+    [] (std::ostream& os, const ndn::nfd::RibEntry& item) {
+      os << "  ";
+      RibModule::formatEntryText(os, item);
+      os << '\n';
+    });
+}
+
+/** \brief The 'face changes' command.
+ */
+static void
+showFaceChanges(ExecuteContext& ctx)
+{
+  showChanges<FaceChangesDataset>(ctx, "face changes dataset",
+    [] (std::ostream& os, const ndn::nfd::FaceStatus& item) {
+      os << "  ";
+      FaceModule::formatItemText(os, item, false);
+      os << '\n';
+    });
+}
+
+void
+registerChangesCommands(CommandParser& parser)
+{
+  CommandDefinition defFibChanges("fib", "changes");
+  defFibChanges
+    .setTitle("print FIB entries changed since a version")
+    .addArg("epoch", ArgValueType::UNSIGNED, Required::NO, Positional::YES)
+    .addArg("since", ArgValueType::UNSIGNED, Required::NO, Positional::YES);
+  parser.addCommand(defFibChanges, &showFibChanges);
+
+  CommandDefinition defRouteChanges("route", "changes");
+  defRouteChanges
+    .setTitle("print RIB entries changed since a version")
+    .addArg("epoch", ArgValueType::UNSIGNED, Required::NO, Positional::YES)
+    .addArg("since", ArgValueType::UNSIGNED, Required::NO, Positional::YES);
+  parser.addCommand(defRouteChanges, &showRibChanges);
+
+  CommandDefinition defFaceChanges("face", "changes");
+  defFaceChanges
+    .setTitle("print faces changed since a version")
+    .addArg("epoch", ArgValueType::UNSIGNED, Required::NO, Positional::YES)
+    .addArg("since", ArgValueType::UNSIGNED, Required::NO, Positional::YES);
+  parser.addCommand(defFaceChanges, &showFaceChanges);
+}
+
+} // namespace nfd::tools::nfdc
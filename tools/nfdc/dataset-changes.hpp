@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NFD_TOOLS_NFDC_DATASET_CHANGES_HPP
+#define NFD_TOOLS_NFDC_DATASET_CHANGES_HPP
+
+#include "command-parser.hpp"
+#include "core/dataset-delta.hpp"
+
+#include <ndn-cxx/mgmt/nfd/face-status.hpp>
+#include <ndn-cxx/mgmt/nfd/fib-entry.hpp>
+#include <ndn-cxx/mgmt/nfd/rib-entry.hpp>
+#include <ndn-cxx/mgmt/nfd/status-dataset.hpp>
+
+namespace nfd::tools::nfdc {
+
+/**
+ * \brief Represents a delta dataset published by NFD, i.e., the changes of a `list` dataset
+ *        since a given epoch and version.
+ * \tparam Item type of the added or changed items
+ * \sa DatasetDeltaHeader
+ */
+template<typename Item>
+class ChangesDataset : public ndn::nfd::StatusDataset
+{
+public:
+  using ParamType = std::optional<DatasetPosition>;
+
+  struct ResultType
+  {
+    DatasetDeltaHeader header;
+    std::vector<Item> items; ///< added or changed items, or every item in a full snapshot
+    std::vector<DatasetRemoval> removals;
+  };
+
+  ResultType
+  parseResult(ndn::ConstBufferPtr payload) const
+  {
+    ResultType result;
+
+    size_t offset = 0;
+    while (offset < payload->size()) {
+      auto [isOk, block] = Block::fromBuffer(payload, offset);
+      if (!isOk) {
+        NDN_THROW(ParseResultError("cannot decode Block at offset " + std::to_string(offset)));
+      }
+
+      try {
+        if (offset == 0) {
+          result.header.wireDecode(block);
+        }
+        else if (block.type() == tlv::DatasetRemoval) {
+          result.removals.emplace_back().wireDecode(block);
+        }
+        else {
+          result.items.emplace_back(block);
+        }
+      }
+      catch (const tlv::Error&) {
+        NDN_THROW_NESTED(ParseResultError("cannot decode item at offset " +
+                                          std::to_string(offset)));
+      }
+      offset += block.size();
+    }
+
+    if (offset == 0) {
+      NDN_THROW(ParseResultError("missing DatasetDeltaHeader"));
+    }
+    return result;
+  }
+
+protected:
+  /**
+   * \param datasetName dataset name relative to the top prefix, e.g., `fib/changes`
+   * \param since the epoch and version of the last response the client has seen;
+   *              nullopt requests a full snapshot
+   */
+  ChangesDataset(const PartialName& datasetName, std::optional<DatasetPosition> since)
+    : StatusDataset(datasetName)
+    , m_since(since)
+  {
+  }
+
+private:
+  void
+  addParameters(Name& prefix) const final
+  {
+    if (m_since) {
+      prefix.appendNumber(m_since->epoch).appendNumber(m_since->version);
+    }
+  }
+
+private:
+  std::optional<DatasetPosition> m_since;
+};
+
+/**
+ * \brief Represents the `fib/changes` dataset.
+ */
+class FibChangesDataset : public ChangesDataset<ndn::nfd::FibEntry>
+{
+public:
+  explicit
+  FibChangesDataset(std::optional<DatasetPosition> since)
+    : ChangesDataset("fib/changes", since)
+  {
+  }
+};
+
+/**
+ * \brief Represents the `rib/changes` dataset.
+ */
+class RibChangesDataset : public ChangesDataset<ndn::nfd::RibEntry>
+{
+public:
+  explicit
+  RibChangesDataset(std::optional<DatasetPosition> since)
+    : ChangesDataset("rib/changes", since)
+  {
+  }
+};
+
+/**
+ * \brief Represents the `faces/changes` dataset.
+ */
+class FaceChangesDataset : public ChangesDataset<ndn::nfd::FaceStatus>
+{
+public:
+  explicit
+  FaceChangesDataset(std::optional<DatasetPosition> since)
+    : ChangesDataset("faces/changes", since)
+  {
+  }
+};
+
+/**
+ * \brief Registers the 'fib changes', 'route changes', and 'face changes' commands.
+ */
+void
+registerChangesCommands(CommandParser& parser);
+
+} // namespace nfd::tools::nfdc
+
+#endif // NFD_TOOLS_NFDC_DATASET_CHANGES_HPP
@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2026,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "latency-module.hpp"
+#include "format-helpers.hpp"
+
+#include <iomanip>
+#include <sstream>
+
+namespace nfd::tools::nfdc {
+
+LatencyDataset::LatencyDataset()
+  : StatusDataset("status/latency")
+{
+}
+
+LatencyDataset::ResultType
+LatencyDataset::parseResult(ndn::ConstBufferPtr payload) const
+{
+  ResultType result;
+
+  size_t offset = 0;
+  while (offset < payload->size()) {
+    auto [isOk, block] = Block::fromBuffer(payload, offset);
+    if (!isOk) {
+      NDN_THROW(ParseResultError("cannot decode Block at offset " + std::to_string(offset)));
+    }
+    offset += block.size();
+
+    try {
+      result.emplace_back().wireDecode(block);
+    }
+    catch (const tlv::Error&) {
+      NDN_THROW_NESTED(ParseResultError("cannot decode LatencyStatus at offset " +
+                                        std::to_string(offset - block.size())));
+    }
+  }
+
+  return result;
+}
+
+void
+LatencyModule::fetchStatus(ndn::nfd::Controller& controller,
+                           const std::function<void()>& onSuccess,
+                           const ndn::nfd::DatasetFailureCallback& onFailure,
+                           const CommandOptions& options)
+{
+  controller.fetch<LatencyDataset>(
+    [this, onSuccess] (const std::vector<LatencyStatus>& result) {
+      m_status = result;
+      onSuccess();
+    },
+    onFailure, options);
+}
+
+static time::nanoseconds
+calculateMean(const LatencyHistogram& histogram)
+{
+  if (histogram.getCount() == 0) {
+    return 0_ns;
+  }
+  return histogram.getSum() / static_cast<int64_t>(histogram.getCount());
+}
+
+// xml::formatDuration() has millisecond precision, which is too coarse for these latencies
+static std::string
+formatXmlDuration(time::nanoseconds d)
+{
+  std::ostringstream str;
+  str << "PT" << d.count() / 1000000000 << '.'
+      << std::setfill('0') << std::setw(9) << d.count() % 1000000000 << 'S';
+  return str.str();
+}
+
+void
+LatencyModule::formatStatusXml(std::ostream& os) const
+{
+  os << "<latency>";
+  for (const auto& item : m_status) {
+    formatItemXml(os, item);
+  }
+  os << "</latency>";
+}
+
+void
+LatencyModule::formatItemXml(std::ostream& os, const LatencyStatus& item)
+{
+  const auto& histogram = item.histogram;
+
+  os << "<latencyHistogram>";
+  os << "<label>" << xml::Text{item.label} << "</label>";
+  if (item.faceId) {
+    os << "<faceId>" << *item.faceId << "</faceId>";
+  }
+  os << "<count>" << histogram.getCount() << "</count>";
+  if (histogram.getCount() > 0) {
+    os << "<mean>" << formatXmlDuration(calculateMean(histogram)) << "</mean>";
+    os << "<p50>" << formatXmlDuration(histogram.getQuantile(0.5)) << "</p50>";
+    os << "<p99>" << formatXmlDuration(histogram.getQuantile(0.99)) << "</p99>";
+    os << "<max>" << formatXmlDuration(histogram.getMax()) << "</max>";
+  }
+  os << "</latencyHistogram>";
+}
+
+void
+LatencyModule::formatStatusText(std::ostream& os) const
+{
+  os << "Latency:\n";
+  for (const auto& item : m_status) {
+    os << "  ";
+    formatItemText(os, item);
+    os << '\n';
+  }
+}
+
+void
+LatencyModule::formatItemText(std::ostream& os, const LatencyStatus& item)
+{
+  const auto& histogram = item.histogram;
+  text::ItemAttributes ia;
+
+  os << item.label << ' ';
+  if (item.faceId) {
+    os << ia("faceid") << *item.faceId;
+  }
+  os << ia("count") << histogram.getCount();
+  if (histogram.getCount() > 0) {
+    os << ia("mean") << text::formatDuration<time::nanoseconds>(calculateMean(histogram))
+       << ia("p50") << text::formatDuration<time::nanoseconds>(histogram.getQuantile(0.5))
+       << ia("p99") << text::formatDuration<time::nanoseconds>(histogram.getQuantile(0.99))
+       << ia("max") << text::formatDuration<time::nanoseconds>(histogram.getMax());
+  }
+  os << ia.end();
+}
+
+} // namespace nfd::tools::nfdc
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -31,6 +31,7 @@
 #include "rib-module.hpp"
 #include "cs-module.hpp"
 #include "strategy-choice-module.hpp"
+#include "latency-module.hpp"
 
 #include <ndn-cxx/security/validator-null.hpp>
 
@@ -69,6 +70,10 @@ reportStatus(ExecuteContext& ctx, const StatusReportOptions& options)
     report.sections.push_back(make_unique<StrategyChoiceModule>());
   }
 
+  if (options.wantLatency) {
+    report.sections.push_back(make_unique<LatencyModule>());
+  }
+
   uint32_t code = report.collect(ctx.face, ctx.keyChain,
                                  ndn::security::getAcceptAllValidator(),
                                  CommandOptions());
@@ -130,6 +135,12 @@ registerStatusCommands(CommandParser& parser)
                     std::bind(&reportStatusSingleSection, _1, &StatusReportOptions::wantForwarderGeneral));
   parser.addAlias("status", "show", "");
 
+  CommandDefinition defStatusLatency("status", "latency");
+  defStatusLatency
+    .setTitle("print latency histograms of forwarding stages and faces");
+  parser.addCommand(defStatusLatency,
+                    std::bind(&reportStatusSingleSection, _1, &StatusReportOptions::wantLatency));
+
   CommandDefinition defChannelList("channel", "list");
   defChannelList
     .setTitle("print channel list");
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2022,  Regents of the University of California,
+ * Copyright (c) 2014-2026,  Regents of the University of California,
  *                           Arizona Board of Regents,
  *                           Colorado State University,
  *                           University Pierre & Marie Curie, Sorbonne University,
@@ -41,6 +41,7 @@ struct StatusReportOptions
   bool wantRib = false;
   bool wantCs = false;
   bool wantStrategyChoice = false;
+  bool wantLatency = false;
 };
 
 /** \brief Collect a status report and write to stdout.
@@ -53,6 +54,7 @@ reportStatus(ExecuteContext& ctx, const StatusReportOptions& options);
  *  Providing the following commands:
  *  \li status report
  *  \li status show
+ *  \li status latency
  *  \li channel list
  *  \li strategy list
  *  \li fib list